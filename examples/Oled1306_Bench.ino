@@ -0,0 +1,116 @@
+/*
+ * Benchmark for <Oled_1306.h> lib
+ * Ver 1 16-X-2026
+ * times PushQueueOLED, PopQueueDisplayOLED for all styles {0..7} and scroll modes {0..4} and SetTimeToRow2
+ * and the text renderers (page aligned blitter vs Adafruit_GFX print) for text size 2 and 3
+ * and reports the bus traffic (bytes, transactions, windows) of each case from FlushStatsOLED
+ * output is one line per case, tab separated, to be compared between library versions
+ * runs on the target, and on the host with the Arduino stand-ins of extras/host (CMakeLists.txt, ctest
+ * oled_bench): there the times are host times and the bus counts are the same as on the target
+ */
+static const char Version[] PROGMEM = "V1 16.X.2026";
+
+#define   BAUDRATE    115200
+#define   BenchRepeat 20                // repetitions per case
+#include <Clock.h>                      // self generated master clock lib
+TimePack  SysClock ;
+Clock     RunClock(SysClock);           // clock instance
+
+#include <Oled_1306.h>
+Oled_1306 RunOled(true);                // Oled instance
+
+//****************************************************************************************/
+void PrintCase(const char* name, uint8_t style, uint8_t scroll, uint32_t PushTime, uint32_t PopTime,
+                OledFlushStats before, OledFlushStats after) {
+  /*
+   * print one benchmark line: name style scroll push[uS] pop[uS] bytes transactions windows (per repetition)
+   */
+  Serial.print(name); Serial.print(F("\t")); Serial.print(style); Serial.print(F("\t")); Serial.print(scroll);
+  Serial.print(F("\t")); Serial.print(PushTime/BenchRepeat); Serial.print(F("\t")); Serial.print(PopTime/BenchRepeat);
+  Serial.print(F("\t")); Serial.print((after.bytesSent-before.bytesSent)/BenchRepeat);
+  Serial.print(F("\t")); Serial.print((after.transactions-before.transactions)/BenchRepeat);
+  Serial.print(F("\t")); Serial.print((after.windows-before.windows)/BenchRepeat);
+  Serial.print(F("\n"));
+}   // end of PrintCase
+
+//****************************************************************************************/
+void setup() {
+  static const char P0[] PROGMEM = "Bench row0";
+  static char D1[] = "12345";
+  static char D2[] = "last row";
+  uint32_t  PushTime, PopTime, start;
+  OledFlushStats  before;
+
+  Serial.begin(BAUDRATE);                   // Serial monitor setup
+  delay(3000);
+  Serial.print(F("\n\n\nOled_1306 benchmark. version: ")); Serial.print(Version);
+  Serial.print(F(" lib: ")); Serial.print(RunOled.getVersion()); Serial.print(F("\n\n"));
+  SysClock = RunClock.begin(SysClock);
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  Serial.print(F("case\tstyle\tscroll\tpush[uS]\tpop[uS]\tbytes\ttrans\twindows\n"));
+  //
+  // 1. queue push/pop per style and scroll mode (first pop of each record, scroll re-push included)
+  //
+  for (uint8_t style=0;style<8;style++) {
+    for (uint8_t scroll=0;scroll<5;scroll++) {
+      PushTime = 0;
+      PopTime = 0;
+      before = RunOled.FlushStatsOLED();
+      for (uint8_t ii=0;ii<BenchRepeat;ii++) {
+        SysClock.clockSec = ii%60;              // move the clock so time rows change
+        start = micros();
+        RunOled.PushQueueOLED(style,scroll,1,P0,nullptr,nullptr,D1,nullptr,D2);
+        PushTime += micros()-start;
+        start = micros();
+        RunOled.PopQueueDisplayOLED(SysClock);
+        while ( RunOled.ServiceOLED() ) ;       // count async transfers in the pop time
+        PopTime += micros()-start;
+      }   // end of repetitions
+      PrintCase("queue",style,scroll,PushTime,PopTime,before,RunOled.FlushStatsOLED());
+      RunOled.PushQueueOLED(3,0,1,P0,nullptr,P0,nullptr);   // clear display and scroll between cases
+      RunOled.PopQueueDisplayOLED(SysClock);
+    }   // end of scroll loop
+  }   // end of style loop
+  //
+  // 2. time row update only
+  //
+  PopTime = 0;
+  before = RunOled.FlushStatsOLED();
+  for (uint8_t ii=0;ii<BenchRepeat;ii++) {
+    SysClock.clockSec = ii%60;
+    start = micros();
+    RunOled.SetTimeToRow2(SysClock);
+    RunOled.show();
+    PopTime += micros()-start;
+  }   // end of repetitions
+  PrintCase("time",0,4,0,PopTime,before,RunOled.FlushStatsOLED());
+  //
+  // 3. text renderer: GFX print vs blitter; row 0 (size 2) and row 1 (size 3), render only
+  //
+  static char T0[] = "ABCDEFGHIJ";
+  static char T1[] = "1234567";
+  for (uint8_t fast=0;fast<2;fast++) {
+    RunOled.SetFastTextOLED(fast);
+    for (uint8_t row=0;row<2;row++) {
+      PopTime = 0;
+      for (uint8_t ii=0;ii<BenchRepeat;ii++) {
+        start = micros();
+        RunOled.SetCharsToRow(row==0 ? T0 : T1,row);
+        PopTime += micros()-start;
+      }   // end of repetitions
+      before = RunOled.FlushStatsOLED();
+      PrintCase(fast ? "blit" : "gfx",row,4,0,PopTime,before,before);
+    }   // end of row loop
+  }   // end of renderer loop
+  RunOled.clear();
+  Serial.print(F("Benchmark completed -END\n"));
+} // end of setup
+
+//****************************************************************************************/
+void loop() {
+  ;
+} // end of loop
+
+//****************************************************************************************/
+//****************************************************************************************/
@@ -0,0 +1,1131 @@
+/*
+ * Golden image and performance regression check for <Oled_1306.h> lib
+ * Ver 3 16-X-2026
+ * renders every style {0..7} x scroll {0..4} x payload set {0..2} record, DisplayProg, DisplayMix and
+ * SetCharsToRow from a blank panel with a fixed time; a queue record is popped through all its scroll
+ * steps (scroll, ..., 0; scroll 4 - one step). Per case and step it takes
+ *  - the frame CRC (FrameCRCOLED), the golden image
+ *  - the bytes sent on the bus (FlushStatsOLED), the performance gate
+ * GoldenRecord 1 - prints the table of the cases, to be pasted into Golden[] below (on a known good
+ *                  library version)
+ * GoldenRecord 0 - compares each case with Golden[]: a different frame, or more bytes than recorded
+ *                  + GoldenByteSlack fails; a failed frame is dumped as hex, a line per page, to be
+ *                  diffed with the dump of the recorded frame (GoldenDump 1 dumps every frame)
+ * the frame CRCs and the bus bytes are the same on every platform (I2C) and are checked in below, a
+ * table per panel geometry (128x64, 128x32, 72x40; ctest oled_golden, oled_golden_128x32 and
+ * oled_golden_72x40); on another geometry the table cases are skipped, with a message; the render time is not: it is board specific and, on the host, only the speed of the build
+ * machine, so no threshold holds for both. The bus bytes set the frame time on the panel (I2C 400 kHz:
+ * ~23 uS a byte), the render time is measured by Oled1306_Bench and StatsOLED
+ * then a frame restored from the render cache is checked against its first render after a live clock
+ * record and after a marquee record (no time row or marquee drawn over it)
+ * and the page aligned text blitter (SetFastTextOLED(1)) is checked to draw the same frame as
+ * Adafruit_GFX print (SetFastTextOLED(0)) for every style on edge case texts
+ * runs on the target, and on the host with the Arduino stand-ins of extras/host (ctest oled_golden)
+ */
+static const char Version[] PROGMEM = "V3 16.X.2026";
+
+#define   BAUDRATE        115200
+#ifndef   GoldenRecord
+  #define GoldenRecord    0             // 1 - print the table; 0 - verify against Golden[]
+#endif  //GoldenRecord
+#ifndef   GoldenDump
+  #define GoldenDump      0             // 1 - dump every frame; 0 - the failed ones
+#endif  //GoldenDump
+#define   GoldenByteSlack 0             // allowed bus bytes increase
+#include <Clock.h>                      // self generated master clock lib
+TimePack  SysClock ;
+Clock     RunClock(SysClock);           // clock instance
+
+#include <Oled_1306.h>
+Oled_1306 RunOled(true);                // Oled instance
+
+struct GoldenDef {
+  uint8_t   kind;                       // 0 - queue record; 1 - DisplayProg; 2 - DisplayMix; 3 - SetCharsToRow
+  uint8_t   style;                      // style / type / row
+  uint8_t   scroll;
+  uint8_t   payload;                    // payload set {0,1,2}
+  uint8_t   step;                       // scroll step of a queue record {<scroll>,...,0}; else 0
+  uint32_t  crc;                        // frame CRC
+  uint32_t  bytes;                      // bytes on the bus in the step
+} ; // end of GoldenDef
+
+#if SCREEN_WIDTH==128 && SCREEN_HEIGHT==64
+static const GoldenDef Golden[] PROGMEM = {          // 128x64
+  {0,0,0,0,0,0xEFB5AF2E,1762},
+  {0,0,1,0,1,0xBD5ECD2B,881},
+  {0,0,1,0,0,0xEFB5AF2E,1945},
+  {0,0,2,0,2,0xBD5ECD2B,881},
+  {0,0,2,0,1,0xBD5ECD2B,1064},
+  {0,0,2,0,0,0xEFB5AF2E,1945},
+  {0,0,3,0,3,0xBD5ECD2B,881},
+  {0,0,3,0,2,0xBD5ECD2B,0},
+  {0,0,3,0,1,0xBD5ECD2B,1064},
+  {0,0,3,0,0,0xEFB5AF2E,1945},
+  {0,0,4,0,4,0xBD5ECD2B,881},
+  {0,1,0,0,0,0xEFB5AF2E,1340},
+  {0,1,1,0,1,0x0CDB5B57,670},
+  {0,1,1,0,0,0xEFB5AF2E,1734},
+  {0,1,2,0,2,0x0CDB5B57,670},
+  {0,1,2,0,1,0x0CDB5B57,1064},
+  {0,1,2,0,0,0xEFB5AF2E,1734},
+  {0,1,3,0,3,0x0CDB5B57,670},
+  {0,1,3,0,2,0x0CDB5B57,0},
+  {0,1,3,0,1,0x0CDB5B57,1064},
+  {0,1,3,0,0,0xEFB5AF2E,1734},
+  {0,1,4,0,4,0x0CDB5B57,670},
+  {0,2,0,0,0,0xEFB5AF2E,1356},
+  {0,2,1,0,1,0x259102D1,678},
+  {0,2,1,0,0,0xEFB5AF2E,1742},
+  {0,2,2,0,2,0x259102D1,678},
+  {0,2,2,0,1,0x259102D1,1064},
+  {0,2,2,0,0,0xEFB5AF2E,1742},
+  {0,2,3,0,3,0x259102D1,678},
+  {0,2,3,0,2,0x259102D1,0},
+  {0,2,3,0,1,0x259102D1,1064},
+  {0,2,3,0,0,0xEFB5AF2E,1742},
+  {0,2,4,0,4,0x259102D1,678},
+  {0,3,0,0,0,0xEFB5AF2E,0},
+  {0,3,1,0,1,0xEFB5AF2E,0},
+  {0,3,1,0,0,0xEFB5AF2E,0},
+  {0,3,2,0,2,0xEFB5AF2E,0},
+  {0,3,2,0,1,0xEFB5AF2E,0},
+  {0,3,2,0,0,0xEFB5AF2E,0},
+  {0,3,3,0,3,0xEFB5AF2E,0},
+  {0,3,3,0,2,0xEFB5AF2E,0},
+  {0,3,3,0,1,0xEFB5AF2E,0},
+  {0,3,3,0,0,0xEFB5AF2E,0},
+  {0,3,4,0,4,0xEFB5AF2E,0},
+  {0,4,0,0,0,0xEFB5AF2E,1650},
+  {0,4,1,0,1,0x78C5A08E,825},
+  {0,4,1,0,0,0xEFB5AF2E,1889},
+  {0,4,2,0,2,0x78C5A08E,825},
+  {0,4,2,0,1,0x78C5A08E,1064},
+  {0,4,2,0,0,0xEFB5AF2E,1889},
+  {0,4,3,0,3,0x78C5A08E,825},
+  {0,4,3,0,2,0x78C5A08E,0},
+  {0,4,3,0,1,0x78C5A08E,1064},
+  {0,4,3,0,0,0xEFB5AF2E,1889},
+  {0,4,4,0,4,0x78C5A08E,825},
+  {0,5,0,0,0,0xEFB5AF2E,1244},
+  {0,5,1,0,1,0xE00A6F74,622},
+  {0,5,1,0,0,0xEFB5AF2E,1686},
+  {0,5,2,0,2,0xE00A6F74,622},
+  {0,5,2,0,1,0xE00A6F74,1064},
+  {0,5,2,0,0,0xEFB5AF2E,1686},
+  {0,5,3,0,3,0xE00A6F74,622},
+  {0,5,3,0,2,0xE00A6F74,0},
+  {0,5,3,0,1,0xE00A6F74,1064},
+  {0,5,3,0,0,0xEFB5AF2E,1686},
+  {0,5,4,0,4,0xE00A6F74,622},
+  {0,6,0,0,0,0xEFB5AF2E,1650},
+  {0,6,1,0,1,0x78C5A08E,825},
+  {0,6,1,0,0,0xEFB5AF2E,1889},
+  {0,6,2,0,2,0x78C5A08E,825},
+  {0,6,2,0,1,0x78C5A08E,1064},
+  {0,6,2,0,0,0xEFB5AF2E,1889},
+  {0,6,3,0,3,0x78C5A08E,825},
+  {0,6,3,0,2,0x78C5A08E,0},
+  {0,6,3,0,1,0x78C5A08E,1064},
+  {0,6,3,0,0,0xEFB5AF2E,1889},
+  {0,6,4,0,4,0x78C5A08E,825},
+  {0,7,0,0,0,0xEFB5AF2E,1244},
+  {0,7,1,0,1,0xE00A6F74,622},
+  {0,7,1,0,0,0xEFB5AF2E,1686},
+  {0,7,2,0,2,0xE00A6F74,622},
+  {0,7,2,0,1,0xE00A6F74,1064},
+  {0,7,2,0,0,0xEFB5AF2E,1686},
+  {0,7,3,0,3,0xE00A6F74,622},
+  {0,7,3,0,2,0xE00A6F74,0},
+  {0,7,3,0,1,0xE00A6F74,1064},
+  {0,7,3,0,0,0xEFB5AF2E,1686},
+  {0,7,4,0,4,0xE00A6F74,622},
+  {0,0,0,1,0,0xEFB5AF2E,2058},
+  {0,0,1,1,1,0xBDD08467,1029},
+  {0,0,1,1,0,0xEFB5AF2E,2093},
+  {0,0,2,1,2,0xBDD08467,1029},
+  {0,0,2,1,1,0xBDD08467,1064},
+  {0,0,2,1,0,0xEFB5AF2E,2093},
+  {0,0,3,1,3,0xBDD08467,1029},
+  {0,0,3,1,2,0xBDD08467,0},
+  {0,0,3,1,1,0xBDD08467,1064},
+  {0,0,3,1,0,0xEFB5AF2E,2093},
+  {0,0,4,1,4,0xBDD08467,1029},
+  {0,1,0,1,0,0xEFB5AF2E,1864},
+  {0,1,1,1,1,0x28776A40,932},
+  {0,1,1,1,0,0xEFB5AF2E,1996},
+  {0,1,2,1,2,0x28776A40,932},
+  {0,1,2,1,1,0x28776A40,1064},
+  {0,1,2,1,0,0xEFB5AF2E,1996},
+  {0,1,3,1,3,0x28776A40,932},
+  {0,1,3,1,2,0x28776A40,0},
+  {0,1,3,1,1,0x28776A40,1064},
+  {0,1,3,1,0,0xEFB5AF2E,1996},
+  {0,1,4,1,4,0x28776A40,932},
+  {0,2,0,1,0,0xEFB5AF2E,1892},
+  {0,2,1,1,1,0xBCA86209,946},
+  {0,2,1,1,0,0xEFB5AF2E,2010},
+  {0,2,2,1,2,0xBCA86209,946},
+  {0,2,2,1,1,0xBCA86209,1064},
+  {0,2,2,1,0,0xEFB5AF2E,2010},
+  {0,2,3,1,3,0xBCA86209,946},
+  {0,2,3,1,2,0xBCA86209,0},
+  {0,2,3,1,1,0xBCA86209,1064},
+  {0,2,3,1,0,0xEFB5AF2E,2010},
+  {0,2,4,1,4,0xBCA86209,946},
+  {0,3,0,1,0,0xEFB5AF2E,0},
+  {0,3,1,1,1,0xEFB5AF2E,0},
+  {0,3,1,1,0,0xEFB5AF2E,0},
+  {0,3,2,1,2,0xEFB5AF2E,0},
+  {0,3,2,1,1,0xEFB5AF2E,0},
+  {0,3,2,1,0,0xEFB5AF2E,0},
+  {0,3,3,1,3,0xEFB5AF2E,0},
+  {0,3,3,1,2,0xEFB5AF2E,0},
+  {0,3,3,1,1,0xEFB5AF2E,0},
+  {0,3,3,1,0,0xEFB5AF2E,0},
+  {0,3,4,1,4,0xEFB5AF2E,0},
+  {0,4,0,1,0,0xEFB5AF2E,2058},
+  {0,4,1,1,1,0x9257800E,1029},
+  {0,4,1,1,0,0xEFB5AF2E,2093},
+  {0,4,2,1,2,0x9257800E,1029},
+  {0,4,2,1,1,0x9257800E,1064},
+  {0,4,2,1,0,0xEFB5AF2E,2093},
+  {0,4,3,1,3,0x9257800E,1029},
+  {0,4,3,1,2,0x9257800E,0},
+  {0,4,3,1,1,0x9257800E,1064},
+  {0,4,3,1,0,0xEFB5AF2E,2093},
+  {0,4,4,1,4,0x9257800E,1029},
+  {0,5,0,1,0,0xEFB5AF2E,1880},
+  {0,5,1,1,1,0x66F98E0B,940},
+  {0,5,1,1,0,0xEFB5AF2E,2004},
+  {0,5,2,1,2,0x66F98E0B,940},
+  {0,5,2,1,1,0x66F98E0B,1064},
+  {0,5,2,1,0,0xEFB5AF2E,2004},
+  {0,5,3,1,3,0x66F98E0B,940},
+  {0,5,3,1,2,0x66F98E0B,0},
+  {0,5,3,1,1,0x66F98E0B,1064},
+  {0,5,3,1,0,0xEFB5AF2E,2004},
+  {0,5,4,1,4,0x66F98E0B,940},
+  {0,6,0,1,0,0xEFB5AF2E,2058},
+  {0,6,1,1,1,0x9257800E,1029},
+  {0,6,1,1,0,0xEFB5AF2E,2093},
+  {0,6,2,1,2,0x9257800E,1029},
+  {0,6,2,1,1,0x9257800E,1064},
+  {0,6,2,1,0,0xEFB5AF2E,2093},
+  {0,6,3,1,3,0x9257800E,1029},
+  {0,6,3,1,2,0x9257800E,0},
+  {0,6,3,1,1,0x9257800E,1064},
+  {0,6,3,1,0,0xEFB5AF2E,2093},
+  {0,6,4,1,4,0x9257800E,1029},
+  {0,7,0,1,0,0xEFB5AF2E,1880},
+  {0,7,1,1,1,0x66F98E0B,940},
+  {0,7,1,1,0,0xEFB5AF2E,2004},
+  {0,7,2,1,2,0x66F98E0B,940},
+  {0,7,2,1,1,0x66F98E0B,1064},
+  {0,7,2,1,0,0xEFB5AF2E,2004},
+  {0,7,3,1,3,0x66F98E0B,940},
+  {0,7,3,1,2,0x66F98E0B,0},
+  {0,7,3,1,1,0x66F98E0B,1064},
+  {0,7,3,1,0,0xEFB5AF2E,2004},
+  {0,7,4,1,4,0x66F98E0B,940},
+  {0,0,0,2,0,0xEFB5AF2E,1000},
+  {0,0,1,2,1,0x40CBBA55,500},
+  {0,0,1,2,0,0xEFB5AF2E,1564},
+  {0,0,2,2,2,0x40CBBA55,500},
+  {0,0,2,2,1,0x40CBBA55,1064},
+  {0,0,2,2,0,0xEFB5AF2E,1564},
+  {0,0,3,2,3,0x40CBBA55,500},
+  {0,0,3,2,2,0x40CBBA55,0},
+  {0,0,3,2,1,0x40CBBA55,1064},
+  {0,0,3,2,0,0xEFB5AF2E,1564},
+  {0,0,4,2,4,0x40CBBA55,500},
+  {0,1,0,2,0,0xEFB5AF2E,984},
+  {0,1,1,2,1,0x6981E3D3,492},
+  {0,1,1,2,0,0xEFB5AF2E,1556},
+  {0,1,2,2,2,0x6981E3D3,492},
+  {0,1,2,2,1,0x6981E3D3,1064},
+  {0,1,2,2,0,0xEFB5AF2E,1556},
+  {0,1,3,2,3,0x6981E3D3,492},
+  {0,1,3,2,2,0x6981E3D3,0},
+  {0,1,3,2,1,0x6981E3D3,1064},
+  {0,1,3,2,0,0xEFB5AF2E,1556},
+  {0,1,4,2,4,0x6981E3D3,492},
+  {0,2,0,2,0,0xEFB5AF2E,1000},
+  {0,2,1,2,1,0x40CBBA55,500},
+  {0,2,1,2,0,0xEFB5AF2E,1564},
+  {0,2,2,2,2,0x40CBBA55,500},
+  {0,2,2,2,1,0x40CBBA55,1064},
+  {0,2,2,2,0,0xEFB5AF2E,1564},
+  {0,2,3,2,3,0x40CBBA55,500},
+  {0,2,3,2,2,0x40CBBA55,0},
+  {0,2,3,2,1,0x40CBBA55,1064},
+  {0,2,3,2,0,0xEFB5AF2E,1564},
+  {0,2,4,2,4,0x40CBBA55,500},
+  {0,3,0,2,0,0xEFB5AF2E,0},
+  {0,3,1,2,1,0xEFB5AF2E,0},
+  {0,3,1,2,0,0xEFB5AF2E,0},
+  {0,3,2,2,2,0xEFB5AF2E,0},
+  {0,3,2,2,1,0xEFB5AF2E,0},
+  {0,3,2,2,0,0xEFB5AF2E,0},
+  {0,3,3,2,3,0xEFB5AF2E,0},
+  {0,3,3,2,2,0xEFB5AF2E,0},
+  {0,3,3,2,1,0xEFB5AF2E,0},
+  {0,3,3,2,0,0xEFB5AF2E,0},
+  {0,3,4,2,4,0xEFB5AF2E,0},
+  {0,4,0,2,0,0xEFB5AF2E,496},
+  {0,4,1,2,1,0x6C253BC1,248},
+  {0,4,1,2,0,0xEFB5AF2E,1312},
+  {0,4,2,2,2,0x6C253BC1,248},
+  {0,4,2,2,1,0x6C253BC1,1064},
+  {0,4,2,2,0,0xEFB5AF2E,1312},
+  {0,4,3,2,3,0x6C253BC1,248},
+  {0,4,3,2,2,0x6C253BC1,0},
+  {0,4,3,2,1,0x6C253BC1,1064},
+  {0,4,3,2,0,0xEFB5AF2E,1312},
+  {0,4,4,2,4,0x6C253BC1,248},
+  {0,5,0,2,0,0xEFB5AF2E,496},
+  {0,5,1,2,1,0x6C253BC1,248},
+  {0,5,1,2,0,0xEFB5AF2E,1312},
+  {0,5,2,2,2,0x6C253BC1,248},
+  {0,5,2,2,1,0x6C253BC1,1064},
+  {0,5,2,2,0,0xEFB5AF2E,1312},
+  {0,5,3,2,3,0x6C253BC1,248},
+  {0,5,3,2,2,0x6C253BC1,0},
+  {0,5,3,2,1,0x6C253BC1,1064},
+  {0,5,3,2,0,0xEFB5AF2E,1312},
+  {0,5,4,2,4,0x6C253BC1,248},
+  {0,6,0,2,0,0xEFB5AF2E,496},
+  {0,6,1,2,1,0x6C253BC1,248},
+  {0,6,1,2,0,0xEFB5AF2E,1312},
+  {0,6,2,2,2,0x6C253BC1,248},
+  {0,6,2,2,1,0x6C253BC1,1064},
+  {0,6,2,2,0,0xEFB5AF2E,1312},
+  {0,6,3,2,3,0x6C253BC1,248},
+  {0,6,3,2,2,0x6C253BC1,0},
+  {0,6,3,2,1,0x6C253BC1,1064},
+  {0,6,3,2,0,0xEFB5AF2E,1312},
+  {0,6,4,2,4,0x6C253BC1,248},
+  {0,7,0,2,0,0xEFB5AF2E,496},
+  {0,7,1,2,1,0x6C253BC1,248},
+  {0,7,1,2,0,0xEFB5AF2E,1312},
+  {0,7,2,2,2,0x6C253BC1,248},
+  {0,7,2,2,1,0x6C253BC1,1064},
+  {0,7,2,2,0,0xEFB5AF2E,1312},
+  {0,7,3,2,3,0x6C253BC1,248},
+  {0,7,3,2,2,0x6C253BC1,0},
+  {0,7,3,2,1,0x6C253BC1,1064},
+  {0,7,3,2,0,0xEFB5AF2E,1312},
+  {0,7,4,2,4,0x6C253BC1,248},
+  {1,0,0,0,0,0xCDF78690,874},
+  {1,1,0,0,0,0xAA0F2EF5,878},
+  {1,2,0,0,0,0x17E63625,672},
+  {1,3,0,0,0,0x701E9E40,676},
+  {2,1,0,0,0,0xBD5ECD2B,881},
+  {2,3,0,0,0,0x259102D1,678},
+  {3,0,0,0,0,0x9A3C7B2B,248},
+  {3,1,0,0,0,0x1220D850,381},
+  {3,2,0,0,0,0xC11995A3,248},
+  {3,3,0,0,0,0xA40AD95E,248},
+  {0xFF,0,0,0,0,0,0}                    // end of table
+};
+#elif SCREEN_WIDTH==128 && SCREEN_HEIGHT==32
+static const GoldenDef Golden[] PROGMEM = {          // 128x32
+  {0,0,0,0,0,0xB2AA7578,632},
+  {0,0,1,0,1,0x7AA0F7FD,316},
+  {0,0,1,0,0,0xB2AA7578,852},
+  {0,0,2,0,2,0x7AA0F7FD,316},
+  {0,0,2,0,1,0x7AA0F7FD,536},
+  {0,0,2,0,0,0xB2AA7578,852},
+  {0,0,3,0,3,0x7AA0F7FD,316},
+  {0,0,3,0,2,0x7AA0F7FD,0},
+  {0,0,3,0,1,0x7AA0F7FD,536},
+  {0,0,3,0,0,0xB2AA7578,852},
+  {0,0,4,0,4,0x7AA0F7FD,316},
+  {0,1,0,0,0,0xB2AA7578,372},
+  {0,1,1,0,1,0x96CEDE9A,186},
+  {0,1,1,0,0,0xB2AA7578,722},
+  {0,1,2,0,2,0x96CEDE9A,186},
+  {0,1,2,0,1,0x96CEDE9A,536},
+  {0,1,2,0,0,0xB2AA7578,722},
+  {0,1,3,0,3,0x96CEDE9A,186},
+  {0,1,3,0,2,0x96CEDE9A,0},
+  {0,1,3,0,1,0x96CEDE9A,536},
+  {0,1,3,0,0,0xB2AA7578,722},
+  {0,1,4,0,4,0x96CEDE9A,186},
+  {0,2,0,0,0,0xB2AA7578,376},
+  {0,2,1,0,1,0x031B896D,188},
+  {0,2,1,0,0,0xB2AA7578,724},
+  {0,2,2,0,2,0x031B896D,188},
+  {0,2,2,0,1,0x031B896D,536},
+  {0,2,2,0,0,0xB2AA7578,724},
+  {0,2,3,0,3,0x031B896D,188},
+  {0,2,3,0,2,0x031B896D,0},
+  {0,2,3,0,1,0x031B896D,536},
+  {0,2,3,0,0,0xB2AA7578,724},
+  {0,2,4,0,4,0x031B896D,188},
+  {0,3,0,0,0,0xB2AA7578,0},
+  {0,3,1,0,1,0xB2AA7578,0},
+  {0,3,1,0,0,0xB2AA7578,0},
+  {0,3,2,0,2,0xB2AA7578,0},
+  {0,3,2,0,1,0xB2AA7578,0},
+  {0,3,2,0,0,0xB2AA7578,0},
+  {0,3,3,0,3,0xB2AA7578,0},
+  {0,3,3,0,2,0xB2AA7578,0},
+  {0,3,3,0,1,0xB2AA7578,0},
+  {0,3,3,0,0,0xB2AA7578,0},
+  {0,3,4,0,4,0xB2AA7578,0},
+  {0,4,0,0,0,0xB2AA7578,606},
+  {0,4,1,0,1,0xABB26281,303},
+  {0,4,1,0,0,0xB2AA7578,839},
+  {0,4,2,0,2,0xABB26281,303},
+  {0,4,2,0,1,0xABB26281,536},
+  {0,4,2,0,0,0xB2AA7578,839},
+  {0,4,3,0,3,0xABB26281,303},
+  {0,4,3,0,2,0xABB26281,0},
+  {0,4,3,0,1,0xABB26281,536},
+  {0,4,3,0,0,0xB2AA7578,839},
+  {0,4,4,0,4,0xABB26281,303},
+  {0,5,0,0,0,0xB2AA7578,350},
+  {0,5,1,0,1,0xD2091C11,175},
+  {0,5,1,0,0,0xB2AA7578,711},
+  {0,5,2,0,2,0xD2091C11,175},
+  {0,5,2,0,1,0xD2091C11,536},
+  {0,5,2,0,0,0xB2AA7578,711},
+  {0,5,3,0,3,0xD2091C11,175},
+  {0,5,3,0,2,0xD2091C11,0},
+  {0,5,3,0,1,0xD2091C11,536},
+  {0,5,3,0,0,0xB2AA7578,711},
+  {0,5,4,0,4,0xD2091C11,175},
+  {0,6,0,0,0,0xB2AA7578,606},
+  {0,6,1,0,1,0xABB26281,303},
+  {0,6,1,0,0,0xB2AA7578,839},
+  {0,6,2,0,2,0xABB26281,303},
+  {0,6,2,0,1,0xABB26281,536},
+  {0,6,2,0,0,0xB2AA7578,839},
+  {0,6,3,0,3,0xABB26281,303},
+  {0,6,3,0,2,0xABB26281,0},
+  {0,6,3,0,1,0xABB26281,536},
+  {0,6,3,0,0,0xB2AA7578,839},
+  {0,6,4,0,4,0xABB26281,303},
+  {0,7,0,0,0,0xB2AA7578,350},
+  {0,7,1,0,1,0xD2091C11,175},
+  {0,7,1,0,0,0xB2AA7578,711},
+  {0,7,2,0,2,0xD2091C11,175},
+  {0,7,2,0,1,0xD2091C11,536},
+  {0,7,2,0,0,0xB2AA7578,711},
+  {0,7,3,0,3,0xD2091C11,175},
+  {0,7,3,0,2,0xD2091C11,0},
+  {0,7,3,0,1,0xD2091C11,536},
+  {0,7,3,0,0,0xB2AA7578,711},
+  {0,7,4,0,4,0xD2091C11,175},
+  {0,0,0,1,0,0xB2AA7578,986},
+  {0,0,1,1,1,0xA328868B,493},
+  {0,0,1,1,0,0xB2AA7578,1029},
+  {0,0,2,1,2,0xA328868B,493},
+  {0,0,2,1,1,0xA328868B,536},
+  {0,0,2,1,0,0xB2AA7578,1029},
+  {0,0,3,1,3,0xA328868B,493},
+  {0,0,3,1,2,0xA328868B,0},
+  {0,0,3,1,1,0xA328868B,536},
+  {0,0,3,1,0,0xB2AA7578,1029},
+  {0,0,4,1,4,0xA328868B,493},
+  {0,1,0,1,0,0xB2AA7578,504},
+  {0,1,1,1,1,0x87F0E220,252},
+  {0,1,1,1,0,0xB2AA7578,788},
+  {0,1,2,1,2,0x87F0E220,252},
+  {0,1,2,1,1,0x87F0E220,536},
+  {0,1,2,1,0,0xB2AA7578,788},
+  {0,1,3,1,3,0x87F0E220,252},
+  {0,1,3,1,2,0x87F0E220,0},
+  {0,1,3,1,1,0x87F0E220,536},
+  {0,1,3,1,0,0xB2AA7578,788},
+  {0,1,4,1,4,0x87F0E220,252},
+  {0,2,0,1,0,0xB2AA7578,642},
+  {0,2,1,1,1,0x20222100,321},
+  {0,2,1,1,0,0xB2AA7578,857},
+  {0,2,2,1,2,0x20222100,321},
+  {0,2,2,1,1,0x20222100,536},
+  {0,2,2,1,0,0xB2AA7578,857},
+  {0,2,3,1,3,0x20222100,321},
+  {0,2,3,1,2,0x20222100,0},
+  {0,2,3,1,1,0x20222100,536},
+  {0,2,3,1,0,0xB2AA7578,857},
+  {0,2,4,1,4,0x20222100,321},
+  {0,3,0,1,0,0xB2AA7578,0},
+  {0,3,1,1,1,0xB2AA7578,0},
+  {0,3,1,1,0,0xB2AA7578,0},
+  {0,3,2,1,2,0xB2AA7578,0},
+  {0,3,2,1,1,0xB2AA7578,0},
+  {0,3,2,1,0,0xB2AA7578,0},
+  {0,3,3,1,3,0xB2AA7578,0},
+  {0,3,3,1,2,0xB2AA7578,0},
+  {0,3,3,1,1,0xB2AA7578,0},
+  {0,3,3,1,0,0xB2AA7578,0},
+  {0,3,4,1,4,0xB2AA7578,0},
+  {0,4,0,1,0,0xB2AA7578,1048},
+  {0,4,1,1,1,0x6B9F7185,524},
+  {0,4,1,1,0,0xB2AA7578,1060},
+  {0,4,2,1,2,0x6B9F7185,524},
+  {0,4,2,1,1,0x6B9F7185,536},
+  {0,4,2,1,0,0xB2AA7578,1060},
+  {0,4,3,1,3,0x6B9F7185,524},
+  {0,4,3,1,2,0x6B9F7185,0},
+  {0,4,3,1,1,0x6B9F7185,536},
+  {0,4,3,1,0,0xB2AA7578,1060},
+  {0,4,4,1,4,0x6B9F7185,524},
+  {0,5,0,1,0,0xB2AA7578,774},
+  {0,5,1,1,1,0x87EF0506,387},
+  {0,5,1,1,0,0xB2AA7578,923},
+  {0,5,2,1,2,0x87EF0506,387},
+  {0,5,2,1,1,0x87EF0506,536},
+  {0,5,2,1,0,0xB2AA7578,923},
+  {0,5,3,1,3,0x87EF0506,387},
+  {0,5,3,1,2,0x87EF0506,0},
+  {0,5,3,1,1,0x87EF0506,536},
+  {0,5,3,1,0,0xB2AA7578,923},
+  {0,5,4,1,4,0x87EF0506,387},
+  {0,6,0,1,0,0xB2AA7578,1048},
+  {0,6,1,1,1,0x6B9F7185,524},
+  {0,6,1,1,0,0xB2AA7578,1060},
+  {0,6,2,1,2,0x6B9F7185,524},
+  {0,6,2,1,1,0x6B9F7185,536},
+  {0,6,2,1,0,0xB2AA7578,1060},
+  {0,6,3,1,3,0x6B9F7185,524},
+  {0,6,3,1,2,0x6B9F7185,0},
+  {0,6,3,1,1,0x6B9F7185,536},
+  {0,6,3,1,0,0xB2AA7578,1060},
+  {0,6,4,1,4,0x6B9F7185,524},
+  {0,7,0,1,0,0xB2AA7578,774},
+  {0,7,1,1,1,0x87EF0506,387},
+  {0,7,1,1,0,0xB2AA7578,923},
+  {0,7,2,1,2,0x87EF0506,387},
+  {0,7,2,1,1,0x87EF0506,536},
+  {0,7,2,1,0,0xB2AA7578,923},
+  {0,7,3,1,3,0x87EF0506,387},
+  {0,7,3,1,2,0x87EF0506,0},
+  {0,7,3,1,1,0x87EF0506,536},
+  {0,7,3,1,0,0xB2AA7578,923},
+  {0,7,4,1,4,0x87EF0506,387},
+  {0,0,0,2,0,0xB2AA7578,276},
+  {0,0,1,2,1,0xF178E428,138},
+  {0,0,1,2,0,0xB2AA7578,674},
+  {0,0,2,2,2,0xF178E428,138},
+  {0,0,2,2,1,0xF178E428,536},
+  {0,0,2,2,0,0xB2AA7578,674},
+  {0,0,3,2,3,0xF178E428,138},
+  {0,0,3,2,2,0xF178E428,0},
+  {0,0,3,2,1,0xF178E428,536},
+  {0,0,3,2,0,0xB2AA7578,674},
+  {0,0,4,2,4,0xF178E428,138},
+  {0,1,0,2,0,0xB2AA7578,272},
+  {0,1,1,2,1,0x64ADB3DF,136},
+  {0,1,1,2,0,0xB2AA7578,672},
+  {0,1,2,2,2,0x64ADB3DF,136},
+  {0,1,2,2,1,0x64ADB3DF,536},
+  {0,1,2,2,0,0xB2AA7578,672},
+  {0,1,3,2,3,0x64ADB3DF,136},
+  {0,1,3,2,2,0x64ADB3DF,0},
+  {0,1,3,2,1,0x64ADB3DF,536},
+  {0,1,3,2,0,0xB2AA7578,672},
+  {0,1,4,2,4,0x64ADB3DF,136},
+  {0,2,0,2,0,0xB2AA7578,276},
+  {0,2,1,2,1,0xF178E428,138},
+  {0,2,1,2,0,0xB2AA7578,674},
+  {0,2,2,2,2,0xF178E428,138},
+  {0,2,2,2,1,0xF178E428,536},
+  {0,2,2,2,0,0xB2AA7578,674},
+  {0,2,3,2,3,0xF178E428,138},
+  {0,2,3,2,2,0xF178E428,0},
+  {0,2,3,2,1,0xF178E428,536},
+  {0,2,3,2,0,0xB2AA7578,674},
+  {0,2,4,2,4,0xF178E428,138},
+  {0,3,0,2,0,0xB2AA7578,0},
+  {0,3,1,2,1,0xB2AA7578,0},
+  {0,3,1,2,0,0xB2AA7578,0},
+  {0,3,2,2,2,0xB2AA7578,0},
+  {0,3,2,2,1,0xB2AA7578,0},
+  {0,3,2,2,0,0xB2AA7578,0},
+  {0,3,3,2,3,0xB2AA7578,0},
+  {0,3,3,2,2,0xB2AA7578,0},
+  {0,3,3,2,1,0xB2AA7578,0},
+  {0,3,3,2,0,0xB2AA7578,0},
+  {0,3,4,2,4,0xB2AA7578,0},
+  {0,4,0,2,0,0xB2AA7578,138},
+  {0,4,1,2,1,0xE9007894,69},
+  {0,4,1,2,0,0xB2AA7578,605},
+  {0,4,2,2,2,0xE9007894,69},
+  {0,4,2,2,1,0xE9007894,536},
+  {0,4,2,2,0,0xB2AA7578,605},
+  {0,4,3,2,3,0xE9007894,69},
+  {0,4,3,2,2,0xE9007894,0},
+  {0,4,3,2,1,0xE9007894,536},
+  {0,4,3,2,0,0xB2AA7578,605},
+  {0,4,4,2,4,0xE9007894,69},
+  {0,5,0,2,0,0xB2AA7578,138},
+  {0,5,1,2,1,0xE9007894,69},
+  {0,5,1,2,0,0xB2AA7578,605},
+  {0,5,2,2,2,0xE9007894,69},
+  {0,5,2,2,1,0xE9007894,536},
+  {0,5,2,2,0,0xB2AA7578,605},
+  {0,5,3,2,3,0xE9007894,69},
+  {0,5,3,2,2,0xE9007894,0},
+  {0,5,3,2,1,0xE9007894,536},
+  {0,5,3,2,0,0xB2AA7578,605},
+  {0,5,4,2,4,0xE9007894,69},
+  {0,6,0,2,0,0xB2AA7578,138},
+  {0,6,1,2,1,0xE9007894,69},
+  {0,6,1,2,0,0xB2AA7578,605},
+  {0,6,2,2,2,0xE9007894,69},
+  {0,6,2,2,1,0xE9007894,536},
+  {0,6,2,2,0,0xB2AA7578,605},
+  {0,6,3,2,3,0xE9007894,69},
+  {0,6,3,2,2,0xE9007894,0},
+  {0,6,3,2,1,0xE9007894,536},
+  {0,6,3,2,0,0xB2AA7578,605},
+  {0,6,4,2,4,0xE9007894,69},
+  {0,7,0,2,0,0xB2AA7578,138},
+  {0,7,1,2,1,0xE9007894,69},
+  {0,7,1,2,0,0xB2AA7578,605},
+  {0,7,2,2,2,0xE9007894,69},
+  {0,7,2,2,1,0xE9007894,536},
+  {0,7,2,2,0,0xB2AA7578,605},
+  {0,7,3,2,3,0xE9007894,69},
+  {0,7,3,2,2,0xE9007894,0},
+  {0,7,3,2,1,0xE9007894,536},
+  {0,7,3,2,0,0xB2AA7578,605},
+  {0,7,4,2,4,0xE9007894,69},
+  {1,0,0,0,0,0xD32E596D,314},
+  {1,1,0,0,0,0xE0EB31B6,314},
+  {1,2,0,0,0,0x5826DEF7,188},
+  {1,3,0,0,0,0x6BE3B62C,188},
+  {2,1,0,0,0,0x7AA0F7FD,316},
+  {2,3,0,0,0,0x031B896D,188},
+  {3,0,0,0,0,0x1AE979FF,69},
+  {3,1,0,0,0,0x397266AD,178},
+  {3,2,0,0,0,0x30F42418,69},
+  {3,3,0,0,0,0x35B216B1,69},
+  {0xFF,0,0,0,0,0,0}                    // end of table
+};
+#elif SCREEN_WIDTH==72 && SCREEN_HEIGHT==40
+static const GoldenDef Golden[] PROGMEM = {          // 72x40
+  {0,0,0,0,0,0x173B47C6,608},
+  {0,0,1,0,1,0xD04B638A,304},
+  {0,0,1,0,0,0x173B47C6,682},
+  {0,0,2,0,2,0xD04B638A,304},
+  {0,0,2,0,1,0xD04B638A,378},
+  {0,0,2,0,0,0x173B47C6,682},
+  {0,0,3,0,3,0xD04B638A,304},
+  {0,0,3,0,2,0xD04B638A,0},
+  {0,0,3,0,1,0xD04B638A,378},
+  {0,0,3,0,0,0x173B47C6,682},
+  {0,0,4,0,4,0xD04B638A,304},
+  {0,1,0,0,0,0x173B47C6,372},
+  {0,1,1,0,1,0x6A6C26BB,186},
+  {0,1,1,0,0,0x173B47C6,564},
+  {0,1,2,0,2,0x6A6C26BB,186},
+  {0,1,2,0,1,0x6A6C26BB,378},
+  {0,1,2,0,0,0x173B47C6,564},
+  {0,1,3,0,3,0x6A6C26BB,186},
+  {0,1,3,0,2,0x6A6C26BB,0},
+  {0,1,3,0,1,0x6A6C26BB,378},
+  {0,1,3,0,0,0x173B47C6,564},
+  {0,1,4,0,4,0x6A6C26BB,186},
+  {0,2,0,0,0,0x173B47C6,376},
+  {0,2,1,0,1,0x1E126B65,188},
+  {0,2,1,0,0,0x173B47C6,566},
+  {0,2,2,0,2,0x1E126B65,188},
+  {0,2,2,0,1,0x1E126B65,378},
+  {0,2,2,0,0,0x173B47C6,566},
+  {0,2,3,0,3,0x1E126B65,188},
+  {0,2,3,0,2,0x1E126B65,0},
+  {0,2,3,0,1,0x1E126B65,378},
+  {0,2,3,0,0,0x173B47C6,566},
+  {0,2,4,0,4,0x1E126B65,188},
+  {0,3,0,0,0,0x173B47C6,0},
+  {0,3,1,0,1,0x173B47C6,0},
+  {0,3,1,0,0,0x173B47C6,0},
+  {0,3,2,0,2,0x173B47C6,0},
+  {0,3,2,0,1,0x173B47C6,0},
+  {0,3,2,0,0,0x173B47C6,0},
+  {0,3,3,0,3,0x173B47C6,0},
+  {0,3,3,0,2,0x173B47C6,0},
+  {0,3,3,0,1,0x173B47C6,0},
+  {0,3,3,0,0,0x173B47C6,0},
+  {0,3,4,0,4,0x173B47C6,0},
+  {0,4,0,0,0,0x173B47C6,582},
+  {0,4,1,0,1,0x05E473D7,291},
+  {0,4,1,0,0,0x173B47C6,669},
+  {0,4,2,0,2,0x05E473D7,291},
+  {0,4,2,0,1,0x05E473D7,378},
+  {0,4,2,0,0,0x173B47C6,669},
+  {0,4,3,0,3,0x05E473D7,291},
+  {0,4,3,0,2,0x05E473D7,0},
+  {0,4,3,0,1,0x05E473D7,378},
+  {0,4,3,0,0,0x173B47C6,669},
+  {0,4,4,0,4,0x05E473D7,291},
+  {0,5,0,0,0,0x173B47C6,350},
+  {0,5,1,0,1,0x8C1A589F,175},
+  {0,5,1,0,0,0x173B47C6,553},
+  {0,5,2,0,2,0x8C1A589F,175},
+  {0,5,2,0,1,0x8C1A589F,378},
+  {0,5,2,0,0,0x173B47C6,553},
+  {0,5,3,0,3,0x8C1A589F,175},
+  {0,5,3,0,2,0x8C1A589F,0},
+  {0,5,3,0,1,0x8C1A589F,378},
+  {0,5,3,0,0,0x173B47C6,553},
+  {0,5,4,0,4,0x8C1A589F,175},
+  {0,6,0,0,0,0x173B47C6,582},
+  {0,6,1,0,1,0x05E473D7,291},
+  {0,6,1,0,0,0x173B47C6,669},
+  {0,6,2,0,2,0x05E473D7,291},
+  {0,6,2,0,1,0x05E473D7,378},
+  {0,6,2,0,0,0x173B47C6,669},
+  {0,6,3,0,3,0x05E473D7,291},
+  {0,6,3,0,2,0x05E473D7,0},
+  {0,6,3,0,1,0x05E473D7,378},
+  {0,6,3,0,0,0x173B47C6,669},
+  {0,6,4,0,4,0x05E473D7,291},
+  {0,7,0,0,0,0x173B47C6,350},
+  {0,7,1,0,1,0x8C1A589F,175},
+  {0,7,1,0,0,0x173B47C6,553},
+  {0,7,2,0,2,0x8C1A589F,175},
+  {0,7,2,0,1,0x8C1A589F,378},
+  {0,7,2,0,0,0x173B47C6,553},
+  {0,7,3,0,3,0x8C1A589F,175},
+  {0,7,3,0,2,0x8C1A589F,0},
+  {0,7,3,0,1,0x8C1A589F,378},
+  {0,7,3,0,0,0x173B47C6,553},
+  {0,7,4,0,4,0x8C1A589F,175},
+  {0,0,0,1,0,0x173B47C6,782},
+  {0,0,1,1,1,0xE17F69F8,391},
+  {0,0,1,1,0,0x173B47C6,769},
+  {0,0,2,1,2,0xE17F69F8,391},
+  {0,0,2,1,1,0xE17F69F8,378},
+  {0,0,2,1,0,0x173B47C6,769},
+  {0,0,3,1,3,0xE17F69F8,391},
+  {0,0,3,1,2,0xE17F69F8,0},
+  {0,0,3,1,1,0xE17F69F8,378},
+  {0,0,3,1,0,0x173B47C6,769},
+  {0,0,4,1,4,0xE17F69F8,391},
+  {0,1,0,1,0,0x173B47C6,522},
+  {0,1,1,1,1,0xCD14D4AD,261},
+  {0,1,1,1,0,0x173B47C6,639},
+  {0,1,2,1,2,0xCD14D4AD,261},
+  {0,1,2,1,1,0xCD14D4AD,378},
+  {0,1,2,1,0,0x173B47C6,639},
+  {0,1,3,1,3,0xCD14D4AD,261},
+  {0,1,3,1,2,0xCD14D4AD,0},
+  {0,1,3,1,1,0xCD14D4AD,378},
+  {0,1,3,1,0,0x173B47C6,639},
+  {0,1,4,1,4,0xCD14D4AD,261},
+  {0,2,0,1,0,0x173B47C6,536},
+  {0,2,1,1,1,0xB3AD95A6,268},
+  {0,2,1,1,0,0x173B47C6,646},
+  {0,2,2,1,2,0xB3AD95A6,268},
+  {0,2,2,1,1,0xB3AD95A6,378},
+  {0,2,2,1,0,0x173B47C6,646},
+  {0,2,3,1,3,0xB3AD95A6,268},
+  {0,2,3,1,2,0xB3AD95A6,0},
+  {0,2,3,1,1,0xB3AD95A6,378},
+  {0,2,3,1,0,0x173B47C6,646},
+  {0,2,4,1,4,0xB3AD95A6,268},
+  {0,3,0,1,0,0x173B47C6,0},
+  {0,3,1,1,1,0x173B47C6,0},
+  {0,3,1,1,0,0x173B47C6,0},
+  {0,3,2,1,2,0x173B47C6,0},
+  {0,3,2,1,1,0x173B47C6,0},
+  {0,3,2,1,0,0x173B47C6,0},
+  {0,3,3,1,3,0x173B47C6,0},
+  {0,3,3,1,2,0x173B47C6,0},
+  {0,3,3,1,1,0x173B47C6,0},
+  {0,3,3,1,0,0x173B47C6,0},
+  {0,3,4,1,4,0x173B47C6,0},
+  {0,4,0,1,0,0x173B47C6,800},
+  {0,4,1,1,1,0x003F261D,400},
+  {0,4,1,1,0,0x173B47C6,778},
+  {0,4,2,1,2,0x003F261D,400},
+  {0,4,2,1,1,0x003F261D,378},
+  {0,4,2,1,0,0x173B47C6,778},
+  {0,4,3,1,3,0x003F261D,400},
+  {0,4,3,1,2,0x003F261D,0},
+  {0,4,3,1,1,0x003F261D,378},
+  {0,4,3,1,0,0x173B47C6,778},
+  {0,4,4,1,4,0x003F261D,400},
+  {0,5,0,1,0,0x173B47C6,560},
+  {0,5,1,1,1,0x98BA28CA,280},
+  {0,5,1,1,0,0x173B47C6,658},
+  {0,5,2,1,2,0x98BA28CA,280},
+  {0,5,2,1,1,0x98BA28CA,378},
+  {0,5,2,1,0,0x173B47C6,658},
+  {0,5,3,1,3,0x98BA28CA,280},
+  {0,5,3,1,2,0x98BA28CA,0},
+  {0,5,3,1,1,0x98BA28CA,378},
+  {0,5,3,1,0,0x173B47C6,658},
+  {0,5,4,1,4,0x98BA28CA,280},
+  {0,6,0,1,0,0x173B47C6,800},
+  {0,6,1,1,1,0x003F261D,400},
+  {0,6,1,1,0,0x173B47C6,778},
+  {0,6,2,1,2,0x003F261D,400},
+  {0,6,2,1,1,0x003F261D,378},
+  {0,6,2,1,0,0x173B47C6,778},
+  {0,6,3,1,3,0x003F261D,400},
+  {0,6,3,1,2,0x003F261D,0},
+  {0,6,3,1,1,0x003F261D,378},
+  {0,6,3,1,0,0x173B47C6,778},
+  {0,6,4,1,4,0x003F261D,400},
+  {0,7,0,1,0,0x173B47C6,560},
+  {0,7,1,1,1,0x98BA28CA,280},
+  {0,7,1,1,0,0x173B47C6,658},
+  {0,7,2,1,2,0x98BA28CA,280},
+  {0,7,2,1,1,0x98BA28CA,378},
+  {0,7,2,1,0,0x173B47C6,658},
+  {0,7,3,1,3,0x98BA28CA,280},
+  {0,7,3,1,2,0x98BA28CA,0},
+  {0,7,3,1,1,0x98BA28CA,378},
+  {0,7,3,1,0,0x173B47C6,658},
+  {0,7,4,1,4,0x98BA28CA,280},
+  {0,0,0,2,0,0x173B47C6,276},
+  {0,0,1,2,1,0x93128FC0,138},
+  {0,0,1,2,0,0x173B47C6,516},
+  {0,0,2,2,2,0x93128FC0,138},
+  {0,0,2,2,1,0x93128FC0,378},
+  {0,0,2,2,0,0x173B47C6,516},
+  {0,0,3,2,3,0x93128FC0,138},
+  {0,0,3,2,2,0x93128FC0,0},
+  {0,0,3,2,1,0x93128FC0,378},
+  {0,0,3,2,0,0x173B47C6,516},
+  {0,0,4,2,4,0x93128FC0,138},
+  {0,1,0,2,0,0x173B47C6,272},
+  {0,1,1,2,1,0xE76CC21E,136},
+  {0,1,1,2,0,0x173B47C6,514},
+  {0,1,2,2,2,0xE76CC21E,136},
+  {0,1,2,2,1,0xE76CC21E,378},
+  {0,1,2,2,0,0x173B47C6,514},
+  {0,1,3,2,3,0xE76CC21E,136},
+  {0,1,3,2,2,0xE76CC21E,0},
+  {0,1,3,2,1,0xE76CC21E,378},
+  {0,1,3,2,0,0x173B47C6,514},
+  {0,1,4,2,4,0xE76CC21E,136},
+  {0,2,0,2,0,0x173B47C6,276},
+  {0,2,1,2,1,0x93128FC0,138},
+  {0,2,1,2,0,0x173B47C6,516},
+  {0,2,2,2,2,0x93128FC0,138},
+  {0,2,2,2,1,0x93128FC0,378},
+  {0,2,2,2,0,0x173B47C6,516},
+  {0,2,3,2,3,0x93128FC0,138},
+  {0,2,3,2,2,0x93128FC0,0},
+  {0,2,3,2,1,0x93128FC0,378},
+  {0,2,3,2,0,0x173B47C6,516},
+  {0,2,4,2,4,0x93128FC0,138},
+  {0,3,0,2,0,0x173B47C6,0},
+  {0,3,1,2,1,0x173B47C6,0},
+  {0,3,1,2,0,0x173B47C6,0},
+  {0,3,2,2,2,0x173B47C6,0},
+  {0,3,2,2,1,0x173B47C6,0},
+  {0,3,2,2,0,0x173B47C6,0},
+  {0,3,3,2,3,0x173B47C6,0},
+  {0,3,3,2,2,0x173B47C6,0},
+  {0,3,3,2,1,0x173B47C6,0},
+  {0,3,3,2,0,0x173B47C6,0},
+  {0,3,4,2,4,0x173B47C6,0},
+  {0,4,0,2,0,0x173B47C6,138},
+  {0,4,1,2,1,0x3D681ECE,69},
+  {0,4,1,2,0,0x173B47C6,447},
+  {0,4,2,2,2,0x3D681ECE,69},
+  {0,4,2,2,1,0x3D681ECE,378},
+  {0,4,2,2,0,0x173B47C6,447},
+  {0,4,3,2,3,0x3D681ECE,69},
+  {0,4,3,2,2,0x3D681ECE,0},
+  {0,4,3,2,1,0x3D681ECE,378},
+  {0,4,3,2,0,0x173B47C6,447},
+  {0,4,4,2,4,0x3D681ECE,69},
+  {0,5,0,2,0,0x173B47C6,138},
+  {0,5,1,2,1,0x3D681ECE,69},
+  {0,5,1,2,0,0x173B47C6,447},
+  {0,5,2,2,2,0x3D681ECE,69},
+  {0,5,2,2,1,0x3D681ECE,378},
+  {0,5,2,2,0,0x173B47C6,447},
+  {0,5,3,2,3,0x3D681ECE,69},
+  {0,5,3,2,2,0x3D681ECE,0},
+  {0,5,3,2,1,0x3D681ECE,378},
+  {0,5,3,2,0,0x173B47C6,447},
+  {0,5,4,2,4,0x3D681ECE,69},
+  {0,6,0,2,0,0x173B47C6,138},
+  {0,6,1,2,1,0x3D681ECE,69},
+  {0,6,1,2,0,0x173B47C6,447},
+  {0,6,2,2,2,0x3D681ECE,69},
+  {0,6,2,2,1,0x3D681ECE,378},
+  {0,6,2,2,0,0x173B47C6,447},
+  {0,6,3,2,3,0x3D681ECE,69},
+  {0,6,3,2,2,0x3D681ECE,0},
+  {0,6,3,2,1,0x3D681ECE,378},
+  {0,6,3,2,0,0x173B47C6,447},
+  {0,6,4,2,4,0x3D681ECE,69},
+  {0,7,0,2,0,0x173B47C6,138},
+  {0,7,1,2,1,0x3D681ECE,69},
+  {0,7,1,2,0,0x173B47C6,447},
+  {0,7,2,2,2,0x3D681ECE,69},
+  {0,7,2,2,1,0x3D681ECE,378},
+  {0,7,2,2,0,0x173B47C6,447},
+  {0,7,3,2,3,0x3D681ECE,69},
+  {0,7,3,2,2,0x3D681ECE,0},
+  {0,7,3,2,1,0x3D681ECE,378},
+  {0,7,3,2,0,0x173B47C6,447},
+  {0,7,4,2,4,0x3D681ECE,69},
+  {1,0,0,0,0,0x30178A9E,306},
+  {1,1,0,0,0,0x6831FFDD,306},
+  {1,2,0,0,0,0x229E3B2C,188},
+  {1,3,0,0,0,0x2C6951A6,188},
+  {2,1,0,0,0,0xD04B638A,304},
+  {2,3,0,0,0,0x1E126B65,188},
+  {3,0,0,0,0,0x2E6EEDBD,69},
+  {3,1,0,0,0,0x9A08BA32,182},
+  {3,2,0,0,0,0xEAF3E8A2,69},
+  {3,3,0,0,0,0x46D6F665,69},
+  {0xFF,0,0,0,0,0,0}                    // end of table
+};
+#else
+  #define GoldenNone                    // no table for the geometry: the table cases are skipped
+static const GoldenDef Golden[] PROGMEM = {
+  {0xFF,0,0,0,0,0,0}                    // end of table
+};
+#endif  //SCREEN_WIDTH
+
+static const char P0[] PROGMEM = "Golden row";
+static const char P1[] PROGMEM = "1234567";
+static const char P2[] PROGMEM = "bottom row";
+static const char P0L[] PROGMEM = "Golden header, long row";
+static char D0[] = "Golden dyn";
+static char D1[] = "7654321";
+static char D2[] = "last row";
+static char D1L[] = "123456789012345678";
+static char D2L[] = "a bottom row, too long";
+static char DE[] = "";
+static char DC[] = "12345";             // fits row 1 on every geometry: the cached record is still
+                                        // payload sets: 0 - fits; 1 - wraps / cut at the edge; 2 - empty rows
+static const char* const SetP0[3] = {P0,P0L,P0};
+static char* const SetD1[3] = {D1,D1L,DE};
+static char* const SetD2[3] = {D2,D2L,DE};
+                                        // edge case texts for the blitter: empty, one char, a full
+                                        // size 1 row, one char over, new lines, chars of the upper font half
+                                        // PROG MEM: the records of both renderers are the same, not cut
+                                        // by the arena room left
+static const char T0[] PROGMEM = "";
+static const char T1[] PROGMEM = "W";
+static const char T2[] PROGMEM = "123456789012345678901";
+static const char T3[] PROGMEM = "1234567890123456789012";
+static const char T4[] PROGMEM = "two\nlines\r";
+static const char T5[] PROGMEM = "\x7F\xAF\xB0\xB1\xFE\xFF";
+static const char T6[] PROGMEM = "  spaces and a text wider than the screen at any size  ";
+static const char* const TextEdge[] = {T0,T1,T2,T3,T4,T5,T6};
+uint16_t  Failed = 0;
+uint16_t  Cases = 0;
+
+//****************************************************************************************/
+void DumpFrame() {
+  /*
+   * print the frame drawn last as hex, a line of <SCREEN_WIDTH> bytes per page
+   */
+  const uint8_t*  frame = RunOled.FrameOLED();
+  if ( frame==nullptr ) return;
+  for (uint8_t page=0;page<SCREEN_PAGES;page++) {
+    Serial.print(F("  page ")); Serial.print(page); Serial.print(F(" "));
+    for (uint8_t col=0;col<SCREEN_WIDTH;col++) {
+      uint8_t value = frame[page*SCREEN_WIDTH+col];
+      if ( value<0x10 ) Serial.print(F("0"));
+      Serial.print(value,HEX);
+    }
+    Serial.print(F("\n"));
+  }   // end of page loop
+}   // end of DumpFrame
+
+//****************************************************************************************/
+void CheckFrame(uint8_t kind, uint8_t style, uint8_t scroll, uint8_t payload, uint8_t step, uint32_t bytes) {
+  /*
+   * record or verify the frame drawn last and the <bytes> sent for it
+   */
+  uint32_t  crc = RunOled.FrameCRCOLED();
+  Cases++;
+  #if GoldenRecord==1
+    Serial.print(F("  {")); Serial.print(kind); Serial.print(F(",")); Serial.print(style);
+    Serial.print(F(",")); Serial.print(scroll); Serial.print(F(",")); Serial.print(payload);
+    Serial.print(F(",")); Serial.print(step); Serial.print(F(",0x")); Serial.print(crc,HEX);
+    Serial.print(F(",")); Serial.print(bytes); Serial.print(F("},\n"));
+  #else
+    GoldenDef golden;
+    for (uint16_t ii=0;;ii++) {                           // find the case
+      memcpy_P(&golden,&Golden[ii],sizeof(GoldenDef));
+      if ( golden.kind==0xFF ) break;
+      if ( golden.kind==kind && golden.style==style && golden.scroll==scroll && golden.payload==payload
+           && golden.step==step ) break;
+    }   // end of table search
+    const __FlashStringHelper* error = nullptr;
+    if ( golden.kind==0xFF ) error = F("not in table");
+    else if ( golden.crc!=crc ) error = F("frame");
+    else if ( bytes>golden.bytes+GoldenByteSlack ) error = F("bytes");
+    if ( error==nullptr && GoldenDump==0 ) return;
+    if ( error!=nullptr ) {
+      Failed++;
+      Serial.print(F("FAIL ")); Serial.print(error); Serial.print(F(" "));
+    }
+    Serial.print(F("case ")); Serial.print(kind); Serial.print(F(",")); Serial.print(style);
+    Serial.print(F(",")); Serial.print(scroll); Serial.print(F(",")); Serial.print(payload);
+    Serial.print(F(" step ")); Serial.print(step); Serial.print(F(" crc 0x")); Serial.print(crc,HEX);
+    Serial.print(F(" (0x")); Serial.print(golden.crc,HEX); Serial.print(F(") bytes ")); Serial.print(bytes);
+    Serial.print(F(" (")); Serial.print(golden.bytes); Serial.print(F(")\n"));
+    DumpFrame();
+  #endif  //GoldenRecord
+}   // end of CheckFrame
+
+//****************************************************************************************/
+void RunCase(uint8_t kind, uint8_t style, uint8_t scroll, uint8_t payload) {
+  /*
+   * render one case from a blank panel and record or verify it; a queue record step by step
+   */
+  RunOled.PushQueueOLED(3,0,1,P0,nullptr,P0,nullptr);     // clear display and scroll
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;
+  while ( RunOled.ServiceOLED() ) ;
+  uint32_t  sent = RunOled.FlushStatsOLED().bytesSent;
+  switch ( kind ) {
+    case  0:                                              // queue record, a pop per scroll step
+      RunOled.PushQueueOLED(style,scroll,1,SetP0[payload],nullptr,nullptr,SetD1[payload],nullptr,SetD2[payload]);
+      for (uint8_t step=scroll;;step--) {
+        RunOled.PopQueueDisplayOLED(SysClock);
+        while ( RunOled.ServiceOLED() ) ;                 // count async transfers in the step
+        uint32_t  bytes = RunOled.FlushStatsOLED().bytesSent-sent;
+        sent += bytes;
+        CheckFrame(kind,style,scroll,payload,step,bytes);
+        if ( step==0 || scroll==4 ) return;               // cleared, or no scroll
+      }   // end of step loop
+    case  1:
+      RunOled.DisplayProg(SysClock,style,P0,P1,P2);
+      break;
+    case  2:
+      RunOled.DisplayMix(SysClock,style,P0,D1);
+      break;
+    case  3:
+      RunOled.SetCharsToRow(style==1 ? D1 : D0,style);
+      RunOled.show();
+      break;
+    default:
+      break;
+  }   // end of kind switch
+  while ( RunOled.ServiceOLED() ) ;                       // count async transfers in the case
+  CheckFrame(kind,style,scroll,payload,0,RunOled.FlushStatsOLED().bytesSent-sent);
+}   // end of RunCase
+
+//****************************************************************************************/
+void RunStateCase(uint8_t kind) {
+  /*
+   * a frame restored from the render cache must not keep the state of the frame before it
+   * <kind>     - 0 - live clock record, then the cached record: the time row is not drawn over it
+   *              1 - marquee record, then the cached record: the marquee does not run over it
+   * the cached record (style 4, rows that fit every geometry) is rendered first for its reference CRC
+   */
+  static const char* const Name[2] = {"live clock","marquee"};
+  RunOled.PushQueueOLED(3,0,1,P0,nullptr,P0,nullptr);     // clear display
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;
+  RunOled.SetRenderCacheOLED(2);
+  RunOled.SetLiveClockOLED(kind==0);
+  RunOled.SetMarqueeOLED(kind==1,50);
+  RunOled.PushQueueOLED(4,4,1,P0,nullptr,nullptr,DC,nullptr,D2);
+  RunOled.PopQueueDisplayOLED(SysClock);                  // rendered and cached
+  while ( RunOled.ServiceOLED() ) ;
+  uint32_t  expect = RunOled.FrameCRCOLED();
+  if ( kind==0 ) RunOled.PushQueueOLED(0,4,1,SetP0[0],nullptr,nullptr,SetD1[0],nullptr,nullptr);
+  else           RunOled.PushQueueOLED(4,4,1,SetP0[1],nullptr,nullptr,SetD1[1],nullptr,SetD2[1]);
+  RunOled.PopQueueDisplayOLED(SysClock);
+  RunOled.PushQueueOLED(4,4,1,P0,nullptr,nullptr,DC,nullptr,D2);
+  RunOled.PopQueueDisplayOLED(SysClock);                  // from the cache
+  for (uint8_t ii=0;ii<25;ii++) {                         // clock seconds and marquee steps pass
+    delay(100);
+    while ( RunOled.ServiceOLED() ) ;
+  }
+  uint32_t  crc = RunOled.FrameCRCOLED();
+  RunOled.SetLiveClockOLED(false);
+  RunOled.SetMarqueeOLED(false,0);
+  RunOled.SetRenderCacheOLED(0);
+  Cases++;
+  if ( crc==expect ) return;
+  Failed++;
+  Serial.print(F("FAIL cached frame after ")); Serial.print(Name[kind]); Serial.print(F(" crc 0x"));
+  Serial.print(crc,HEX); Serial.print(F(" (0x")); Serial.print(expect,HEX); Serial.print(F(")\n"));
+}   // end of RunStateCase
+
+//****************************************************************************************/
+void RunTextCase(uint8_t style, uint8_t text) {
+  /*
+   * the page aligned blitter must draw the same frame as Adafruit_GFX print
+   * a record of <style> with the edge case <text> on every row is rendered with each renderer
+   */
+  uint32_t  crc[2];
+  for (uint8_t fast=0;fast<2;fast++) {
+    RunOled.SetFastTextOLED(fast==1);
+    RunOled.PushQueueOLED(3,0,1,P0,nullptr,P0,nullptr);   // clear display
+    while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;
+    RunOled.PushQueueOLED(style,1,1,TextEdge[text],nullptr,TextEdge[text],nullptr,TextEdge[text],nullptr);
+    RunOled.PopQueueDisplayOLED(SysClock);
+    while ( RunOled.ServiceOLED() ) ;
+    crc[fast] = RunOled.FrameCRCOLED();
+  }   // end of renderer loop
+  RunOled.SetFastTextOLED(true);
+  Cases++;
+  if ( crc[0]==crc[1] ) return;
+  Failed++;
+  Serial.print(F("FAIL fast text style ")); Serial.print(style); Serial.print(F(" text ")); Serial.print(text);
+  Serial.print(F(" crc 0x")); Serial.print(crc[1],HEX); Serial.print(F(" (GFX 0x")); Serial.print(crc[0],HEX);
+  Serial.print(F(")\n"));
+}   // end of RunTextCase
+
+//****************************************************************************************/
+void setup() {
+  Serial.begin(BAUDRATE);                   // Serial monitor setup
+  delay(3000);
+  Serial.print(F("\n\n\nOled_1306 golden check. version: ")); Serial.print(Version);
+  Serial.print(F(" lib: ")); Serial.print(RunOled.getVersion()); Serial.print(F("\n\n"));
+  SysClock = RunClock.begin(SysClock);
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  SysClock.clockHour = 12;                  // fixed time row
+  SysClock.clockMin = 34;
+  SysClock.clockSec = 56;
+  #if GoldenRecord==1
+    Serial.print(F("static const GoldenDef Golden[] PROGMEM = {\n"));
+  #endif  //GoldenRecord
+  #if GoldenRecord==0 && defined(GoldenNone)
+    Serial.print(F("SKIP no golden table for ")); Serial.print(SCREEN_WIDTH); Serial.print(F("x"));
+    Serial.print(SCREEN_HEIGHT); Serial.print(F(", the table cases are not checked\n"));
+  #else
+    for (uint8_t payload=0;payload<3;payload++) {
+      for (uint8_t style=0;style<8;style++) {
+        for (uint8_t scroll=0;scroll<5;scroll++) RunCase(0,style,scroll,payload);
+      }
+    }
+    for (uint8_t type=0;type<4;type++) RunCase(1,type,0,0);
+    RunCase(2,1,0,0);
+    RunCase(2,3,0,0);
+    for (uint8_t row=0;row<4;row++) RunCase(3,row,0,0);
+  #endif  //GoldenNone
+  #if GoldenRecord==0
+    RunStateCase(0);
+    RunStateCase(1);
+    for (uint8_t style=0;style<8;style++) {
+      for (uint8_t text=0;text<sizeof(TextEdge)/sizeof(TextEdge[0]);text++) RunTextCase(style,text);
+    }
+  #endif  //GoldenRecord
+  RunOled.clear();
+  #if GoldenRecord==1
+    Serial.print(F("  {0xFF,0,0,0,0,0,0}                    // end of table\n};\n"));
+    Serial.print(F("recorded ")); Serial.print(Cases); Serial.print(F(" cases -END\n"));
+  #else
+    Serial.print(F("checked ")); Serial.print(Cases); Serial.print(F(" cases, failed "));
+    Serial.print(Failed); Serial.print(Failed==0 ? F(" -PASS\n") : F(" -FAIL\n"));
+  #endif  //GoldenRecord
+} // end of setup
+
+//****************************************************************************************/
+void loop() {
+  ;
+} // end of loop
+
+//****************************************************************************************/
+//****************************************************************************************/
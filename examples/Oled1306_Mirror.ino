@@ -0,0 +1,76 @@
+/*
+ * Frame mirroring loopback for <Oled_1306.h> lib
+ * Ver 1 16-X-2026
+ * the mirroring stream of the panel is fed back into an OledMirror decoder on the same unit
+ * (in the field the stream goes to a WiFiClient, RunOled.SetMirrorOLED(&client), and the
+ * decoder runs on the dashboard host; OledMirror.h/.cpp build there as plain C++)
+ * every 10 frames the bytes per frame are printed, and the decoded image is drawn on Serial
+ */
+static const char Version[] PROGMEM = "V1 16.X.2026";
+
+#define   BAUDRATE    115200
+#include <Clock.h>                      // self generated master clock lib
+TimePack  SysClock ;
+Clock     RunClock(SysClock);           // clock instance
+
+#include <Oled_1306.h>
+Oled_1306 RunOled(true);                // Oled instance
+OledMirror  Viewer;                     // decoder, as on the dashboard host
+uint32_t  StreamBytes = 0;
+
+//****************************************************************************************/
+void Loopback(const uint8_t* data, uint16_t length, void* context) {
+  /*
+   * mirror sink: feed the decoder directly
+   */
+  (void)context;
+  StreamBytes += length;
+  Viewer.Feed(data,length);
+  if ( Viewer.NeedKey() ) RunOled.MirrorKeyOLED();
+}   // end of Loopback
+
+//****************************************************************************************/
+void PrintImage() {
+  /*
+   * draw the decoded image on Serial, one char per 2x4 pixels
+   */
+  for (uint8_t y=0;y<Viewer.Height();y+=4) {
+    for (uint8_t x=0;x<Viewer.Width();x+=2) Serial.print(Viewer.Pixel(x,y) ? '#' : '.');
+    Serial.print(F("\n"));
+  }
+}   // end of PrintImage
+
+//****************************************************************************************/
+void setup() {
+  Serial.begin(BAUDRATE);                   // Serial monitor setup
+  delay(3000);
+  Serial.print(F("\n\n\nOled_1306 mirror loopback. version: ")); Serial.print(Version);
+  Serial.print(F(" lib: ")); Serial.print(RunOled.getVersion()); Serial.print(F("\n\n"));
+  SysClock = RunClock.begin(SysClock);
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  RunOled.SetMirrorOLED(Loopback,nullptr);
+} // end of setup
+
+//****************************************************************************************/
+void loop() {
+  static uint16_t count = 0;
+  static char Counter[8];
+  static const char P0[] PROGMEM = "Mirror";
+  SysClock.clockSec = count%60;               // move the time row
+  itoa(count,Counter,10);
+  RunOled.PushQueueOLED(0,4,0,P0,nullptr,nullptr,Counter);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;
+  if ( ++count%10==0 ) {
+    OledFlushStats  stats = RunOled.FlushStatsOLED();
+    Serial.print(F("frames ")); Serial.print(stats.mirrorFrames);
+    Serial.print(F(" bytes/frame ")); Serial.print(stats.mirrorBytes/stats.mirrorFrames);
+    Serial.print(F(" (full frame ")); Serial.print(1024); Serial.print(F(") decoded ")); Serial.print(Viewer.Frames());
+    Serial.print(F(" errors ")); Serial.print(Viewer.Errors()); Serial.print(F("\n"));
+    PrintImage();
+  }
+  delay(500);
+} // end of loop
+
+//****************************************************************************************/
+//****************************************************************************************/
@@ -0,0 +1,63 @@
+/*
+ * Retained screen with bound fields for <Oled_1306.h> lib
+ * Ver 1 16-X-2026
+ * a dashboard defined once (ScreenOLED): labels, a field bound to a variable and fields set by
+ * SetFieldOLED; TickOLED redraws and flushes only the fields whose text changed
+ * every 10 seconds an alert record covers the screen for 2 seconds, then the screen is back
+ */
+static const char Version[] PROGMEM = "V1 16.X.2026";
+
+#define   BAUDRATE    115200
+#include <Clock.h>                      // self generated master clock lib
+TimePack  SysClock ;
+Clock     RunClock(SysClock);           // clock instance
+
+#include <Oled_1306.h>
+Oled_1306 RunOled(true);                // Oled instance
+
+static const char LTemp[] PROGMEM = "Temp";
+static const char LCount[] PROGMEM = "Cnt";
+static const char Alert[] PROGMEM = "ALERT";
+char      Temp[8] = "--";               // bound: read on every refresh
+static const OledFieldDef Dash[] = {
+  {0,0,2,4,LTemp,nullptr},              // label
+  {64,0,2,5,nullptr,Temp},              // bound variable
+  {0,16,2,4,LCount,nullptr},            // label
+  {64,16,2,5,nullptr,nullptr},          // 3 - SetFieldOLED
+  {0,48,2,10,nullptr,nullptr}           // 4 - SetFieldOLED
+};
+
+//****************************************************************************************/
+void setup() {
+  Serial.begin(BAUDRATE);                   // Serial monitor setup
+  delay(3000);
+  Serial.print(F("\n\n\nOled_1306 retained screen. version: ")); Serial.print(Version);
+  Serial.print(F(" lib: ")); Serial.print(RunOled.getVersion()); Serial.print(F("\n\n"));
+  SysClock = RunClock.begin(SysClock);
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  RunOled.SetDwellOLED(20,20);              // records: 2 seconds, then the screen is back
+  RunOled.SetFieldOLED(4,"status ok");
+  RunOled.ScreenOLED(Dash,sizeof(Dash)/sizeof(Dash[0]));
+} // end of setup
+
+//****************************************************************************************/
+void loop() {
+  static uint32_t count = 0;
+  static uint32_t last = 0;
+  uint32_t  now = millis();
+  if ( now-last>=1000 ) {                   // new values once a second
+    last = now;
+    count++;
+    dtostrf(20.0+(count%10)*0.1,4,1,Temp);
+    RunOled.SetFieldOLED(3,(int32_t)count);
+    if ( count%10==0 ) RunOled.PushQueueOLED(4,4,0,Alert,nullptr,nullptr,Temp,LTemp,nullptr);
+    OledFlushStats  stats = RunOled.FlushStatsOLED();
+    Serial.print(F("count ")); Serial.print(count); Serial.print(F(" bytes sent ")); Serial.print(stats.bytesSent);
+    Serial.print(F(" saved ")); Serial.print(stats.bytesSaved); Serial.print(F("\n"));
+  }
+  RunOled.TickOLED(SysClock,now);
+} // end of loop
+
+//****************************************************************************************/
+//****************************************************************************************/
@@ -0,0 +1,55 @@
+/*
+ * Text only display without a frame buffer for <Oled_1306.h> lib
+ * Ver 1 16-X-2026
+ * the DisplayProg/DisplayMemory screens of the library drawn by OledTiles: glyph tiles rendered
+ * page by page straight to the panel GDDRAM, no Adafruit_SSD1306 frame buffer in RAM
+ * every 10 updates the bus bytes per update and the pages skipped are printed
+ */
+static const char Version[] PROGMEM = "V1 16.X.2026";
+
+#define   BAUDRATE    115200
+#include <Clock.h>                      // self generated master clock lib
+TimePack  SysClock ;
+Clock     RunClock(SysClock);           // clock instance
+
+#include <OledTiles.h>
+OledI2C   Bus(&Wire,SCREEN_ADDRESS);    // panel transport
+OledTiles RunTiles(&Bus);               // text only display
+
+static const char P0[] PROGMEM = "Tiles";
+static const char P1[] PROGMEM = "no buffer";
+
+//****************************************************************************************/
+void setup() {
+  Serial.begin(BAUDRATE);                   // Serial monitor setup
+  delay(3000);
+  Serial.print(F("\n\n\nOled_1306 tile text. version: ")); Serial.print(Version);
+  Serial.print(F(" RAM: ")); Serial.print(sizeof(RunTiles)); Serial.print(F(" bytes\n\n"));
+  SysClock = RunClock.begin(SysClock);
+  Wire.begin();                             // the bus is started by the application
+  RunTiles.begin();
+} // end of setup
+
+//****************************************************************************************/
+void loop() {
+  static uint16_t count = 0;
+  static char Counter[8];
+  SysClock.clockSec = count%60;             // move the time row
+  if ( count%5==0 ) {                       // a counter screen every 5 updates, else the time only
+    itoa(count,Counter,10);
+    RunTiles.DisplayMemory(SysClock,0,(char*)"Counter",Counter,(char*)"tiles");
+  } else {
+    RunTiles.DisplayProg(SysClock,1,P0,P1);
+  }
+  if ( ++count%10==0 ) {
+    OledTileStats stats = RunTiles.Stats();
+    Serial.print(F("updates ")); Serial.print(stats.updates);
+    Serial.print(F(" bytes/update ")); Serial.print(Bus.Stats().bytes/stats.updates);
+    Serial.print(F(" (full frame ")); Serial.print(SCREEN_BUFSIZE); Serial.print(F(") pages skipped "));
+    Serial.print(stats.pagesSkipped); Serial.print(F("\n"));
+  }
+  delay(500);
+} // end of loop
+
+//****************************************************************************************/
+//****************************************************************************************/
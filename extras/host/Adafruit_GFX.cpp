@@ -0,0 +1,96 @@
+/*
+ * Adafruit_GFX.cpp host stand-in: text and line drawing as Adafruit_GFX (classic font)
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Adafruit_GFX.h"
+#include  "glcdfont.c"
+
+//****************************************************************************************/
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
+  _width = w;
+  _height = h;
+  cursor_x = 0;
+  cursor_y = 0;
+  textcolor = textbgcolor = 0xFFFF;
+  textsize_x = textsize_y = 1;
+  wrap = true;
+  _cp437 = false;
+}     // end of Adafruit_GFX
+
+//****************************************************************************************/
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t ii=x;ii<x+w;ii++) {
+    for (int16_t jj=y;jj<y+h;jj++) drawPixel(ii,jj,color);
+  }
+}   // end of fillRect
+
+//****************************************************************************************/
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  /*
+   * Bresenham, as Adafruit_GFX::writeLine
+   */
+  bool  steep = abs(y1-y0)>abs(x1-x0);
+  int16_t t;
+  if ( steep ) {
+    t = x0; x0 = y0; y0 = t;
+    t = x1; x1 = y1; y1 = t;
+  }
+  if ( x0>x1 ) {
+    t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
+  int16_t dx = x1-x0;
+  int16_t dy = abs(y1-y0);
+  int16_t err = dx/2;
+  int16_t ystep = y0<y1 ? 1 : -1;
+  for (;x0<=x1;x0++) {
+    if ( steep ) drawPixel(y0,x0,color);
+    else drawPixel(x0,y0,color);
+    err -= dy;
+    if ( err<0 ) {
+      y0 += ystep;
+      err += dx;
+    }
+  }
+}   // end of drawLine
+
+//****************************************************************************************/
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  fillRect(x,y,w,1,color);
+  fillRect(x,y+h-1,w,1,color);
+  fillRect(x,y,1,h,color);
+  fillRect(x+w-1,y,1,h,color);
+}   // end of drawRect
+
+//****************************************************************************************/
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+                            uint8_t size_x, uint8_t size_y) {
+  if ( x>=_width || y>=_height || x+6*size_x-1<0 || y+8*size_y-1<0 ) return;
+  if ( !_cp437 && c>=176 ) c++;                           // the original skips a glyph
+  for (int8_t ii=0;ii<5;ii++) {
+    uint8_t line = pgm_read_byte(&font[c*5+ii]);
+    for (int8_t jj=0;jj<8;jj++,line>>=1) {
+      if ( line&1 ) fillRect(x+ii*size_x,y+jj*size_y,size_x,size_y,color);
+      else if ( bg!=color ) fillRect(x+ii*size_x,y+jj*size_y,size_x,size_y,bg);
+    }
+  }
+  if ( bg!=color ) fillRect(x+5*size_x,y,size_x,8*size_y,bg);
+}   // end of drawChar
+
+//****************************************************************************************/
+size_t Adafruit_GFX::write(uint8_t c) {
+  if ( c=='\n' ) {
+    cursor_x = 0;
+    cursor_y += textsize_y*8;
+  } else if ( c!='\r' ) {
+    if ( wrap && cursor_x+textsize_x*6>_width ) {
+      cursor_x = 0;
+      cursor_y += textsize_y*8;
+    }
+    drawChar(cursor_x,cursor_y,c,textcolor,textbgcolor,textsize_x,textsize_y);
+    cursor_x += textsize_x*6;
+  }
+  return  1;
+}   // end of write
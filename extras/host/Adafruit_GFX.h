@@ -0,0 +1,54 @@
+/*
+ * Adafruit_GFX.h host stand-in: the part of Adafruit_GFX the library uses, classic font only,
+ * drawn with the same pixel rules (text wrap, cursor, scaled glyphs) as the original
+ *
+ *  16-X-2026 V1
+ */
+#ifndef _ADAFRUIT_GFX_H
+  #define _ADAFRUIT_GFX_H
+
+  #include  "Arduino.h"
+
+  struct GFXfont;
+
+  /****************************************************************************************/
+  class Adafruit_GFX : public Print
+  {
+    public:
+      Adafruit_GFX(int16_t w, int16_t h);
+      virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+      virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+      void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+      void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+      void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+                    uint8_t size_x, uint8_t size_y);
+      void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+      void setTextSize(uint8_t s) { textsize_x = textsize_y = s>0 ? s : 1; }
+      void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+      void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+      void setTextWrap(bool w) { wrap = w; }
+      void setFont(const GFXfont* f=nullptr) { (void)f; }
+      void cp437(bool x=true) { _cp437 = x; }
+      int16_t width() const { return _width; }
+      int16_t height() const { return _height; }
+      int16_t getCursorX() const { return cursor_x; }
+      int16_t getCursorY() const { return cursor_y; }
+      size_t write(uint8_t c);
+      using Print::write;
+    protected:
+      int16_t WIDTH;
+      int16_t HEIGHT;
+      int16_t _width;
+      int16_t _height;
+      int16_t cursor_x;
+      int16_t cursor_y;
+      uint16_t textcolor;
+      uint16_t textbgcolor;
+      uint8_t textsize_x;
+      uint8_t textsize_y;
+      bool wrap;
+      bool _cp437;
+  };
+
+#endif   //_ADAFRUIT_GFX_H
+/****************************************************************************************/
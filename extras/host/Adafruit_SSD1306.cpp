@@ -0,0 +1,62 @@
+/*
+ * Adafruit_SSD1306.cpp host stand-in: frame buffer allocation and pixel drawing as Adafruit_SSD1306
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Adafruit_SSD1306.h"
+
+//****************************************************************************************/
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst_pin,
+                                   uint32_t clkDuring, uint32_t clkAfter) : Adafruit_GFX(w,h) {
+  (void)twi; (void)rst_pin; (void)clkDuring; (void)clkAfter;
+  buffer = nullptr;
+}     // end of Adafruit_SSD1306
+
+//****************************************************************************************/
+Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass* spi, int16_t dc_pin, int16_t rst_pin,
+                                   int16_t cs_pin, uint32_t bitrate) : Adafruit_GFX(w,h) {
+  (void)spi; (void)dc_pin; (void)rst_pin; (void)cs_pin; (void)bitrate;
+  buffer = nullptr;
+}     // end of Adafruit_SSD1306
+
+//****************************************************************************************/
+Adafruit_SSD1306::~Adafruit_SSD1306() {
+  free(buffer);
+}   // end of ~Adafruit_SSD1306
+
+//****************************************************************************************/
+bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset, bool periphBegin) {
+  /*
+   * the frame buffer is allocated here, as the original (nullptr before begin)
+   */
+  (void)vcs; (void)addr; (void)reset; (void)periphBegin;
+  if ( buffer==nullptr ) buffer = (uint8_t*)malloc(WIDTH*((HEIGHT+7)/8));
+  if ( buffer==nullptr ) return false;
+  clearDisplay();
+  return  true;
+}   // end of begin
+
+//****************************************************************************************/
+void Adafruit_SSD1306::clearDisplay() {
+  memset(buffer,0,WIDTH*((HEIGHT+7)/8));
+}   // end of clearDisplay
+
+//****************************************************************************************/
+void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ( x<0 || y<0 || x>=_width || y>=_height ) return;
+  uint8_t* p = &buffer[x+(y/8)*WIDTH];
+  switch ( color ) {
+    case  SSD1306_WHITE:
+      *p |= 1<<(y&7);
+      break;
+    case  SSD1306_BLACK:
+      *p &= ~(1<<(y&7));
+      break;
+    case  SSD1306_INVERSE:
+      *p ^= 1<<(y&7);
+      break;
+    default:
+      break;
+  }
+}   // end of drawPixel
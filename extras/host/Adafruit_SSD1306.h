@@ -0,0 +1,77 @@
+/*
+ * Adafruit_SSD1306.h host stand-in: the frame buffer and drawing of Adafruit_SSD1306; begin() and
+ * display() do not reach a bus (the library sends its windows through OledTransport)
+ *
+ *  16-X-2026 V1
+ */
+#ifndef _Adafruit_SSD1306_H_
+  #define _Adafruit_SSD1306_H_
+
+  #include  "Adafruit_GFX.h"
+  #include  "Wire.h"
+  #include  "SPI.h"
+
+  #define   SSD1306_BLACK                 0
+  #define   SSD1306_WHITE                 1
+  #define   SSD1306_INVERSE               2
+  #define   BLACK                         SSD1306_BLACK
+  #define   WHITE                         SSD1306_WHITE
+  #define   INVERSE                       SSD1306_INVERSE
+
+  #define   SSD1306_MEMORYMODE            0x20
+  #define   SSD1306_COLUMNADDR            0x21
+  #define   SSD1306_PAGEADDR              0x22
+  #define   SSD1306_SETCONTRAST           0x81
+  #define   SSD1306_CHARGEPUMP            0x8D
+  #define   SSD1306_SEGREMAP              0xA0
+  #define   SSD1306_DISPLAYALLON_RESUME   0xA4
+  #define   SSD1306_DISPLAYALLON          0xA5
+  #define   SSD1306_NORMALDISPLAY         0xA6
+  #define   SSD1306_INVERTDISPLAY         0xA7
+  #define   SSD1306_SETMULTIPLEX          0xA8
+  #define   SSD1306_DISPLAYOFF            0xAE
+  #define   SSD1306_DISPLAYON             0xAF
+  #define   SSD1306_COMSCANINC            0xC0
+  #define   SSD1306_COMSCANDEC            0xC8
+  #define   SSD1306_SETDISPLAYOFFSET      0xD3
+  #define   SSD1306_SETDISPLAYCLOCKDIV    0xD5
+  #define   SSD1306_SETPRECHARGE          0xD9
+  #define   SSD1306_SETCOMPINS            0xDA
+  #define   SSD1306_SETVCOMDETECT         0xDB
+  #define   SSD1306_SETLOWCOLUMN          0x00
+  #define   SSD1306_SETHIGHCOLUMN         0x10
+  #define   SSD1306_SETSTARTLINE          0x40
+  #define   SSD1306_EXTERNALVCC           0x01
+  #define   SSD1306_SWITCHCAPVCC          0x02
+  #define   SSD1306_RIGHT_HORIZONTAL_SCROLL 0x26
+  #define   SSD1306_LEFT_HORIZONTAL_SCROLL  0x27
+  #define   SSD1306_DEACTIVATE_SCROLL     0x2E
+  #define   SSD1306_ACTIVATE_SCROLL       0x2F
+
+  /****************************************************************************************/
+  class Adafruit_SSD1306 : public Adafruit_GFX
+  {
+    public:
+      Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire* twi=&Wire, int8_t rst_pin=-1,
+                    uint32_t clkDuring=400000UL, uint32_t clkAfter=100000UL);
+      Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass* spi, int16_t dc_pin, int16_t rst_pin,
+                    int16_t cs_pin, uint32_t bitrate=8000000UL);
+      ~Adafruit_SSD1306();
+      bool begin(uint8_t vcs=SSD1306_SWITCHCAPVCC, uint8_t addr=0, bool reset=true, bool periphBegin=true);
+      void display() { displays++; }
+      void clearDisplay();
+      void drawPixel(int16_t x, int16_t y, uint16_t color);
+      void invertDisplay(bool i) { (void)i; }
+      void dim(bool dim) { (void)dim; }
+      void startscrollright(uint8_t start, uint8_t stop) { (void)start; (void)stop; }
+      void startscrollleft(uint8_t start, uint8_t stop) { (void)start; (void)stop; }
+      void stopscroll() {}
+      void ssd1306_command(uint8_t c) { (void)c; }
+      uint8_t* getBuffer() { return buffer; }
+      uint32_t displays = 0;                  // full frame display() calls
+    protected:
+      uint8_t* buffer;
+  };
+
+#endif   //_Adafruit_SSD1306_H_
+/****************************************************************************************/
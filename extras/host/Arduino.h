@@ -0,0 +1,86 @@
+/*
+ * Arduino.h host stand-in for the Oled_1306 host build (CMakeLists.txt)
+ * only what the library and the check sketches use: PROGMEM is regular memory, Serial is stdout,
+ * delay() advances millis()/micros() without waiting
+ *
+ *  16-X-2026 V1
+ */
+#ifndef Arduino_h
+  #define Arduino_h
+
+  #include  <stdint.h>
+  #include  <stddef.h>
+  #include  <string.h>
+  #include  <stdlib.h>
+  #include  <stdio.h>
+
+  #define   PROGMEM
+  #define   IRAM_ATTR
+  #define   ICACHE_RAM_ATTR
+  #define   HEX     16
+  #define   DEC     10
+  #define   HIGH    1
+  #define   LOW     0
+  #define   OUTPUT  1
+  #define   INPUT   0
+
+  class __FlashStringHelper;
+  #define   F(x)    (reinterpret_cast<const __FlashStringHelper*>(x))
+  #define   strlen_P            strlen
+  #define   strcpy_P            strcpy
+  #define   strncpy_P           strncpy
+  #define   strcmp_P            strcmp
+  #define   memcpy_P            memcpy
+  #define   memcmp_P            memcmp
+  #define   pgm_read_byte(p)    (*(const uint8_t*)(p))
+  #define   pgm_read_word(p)    (*(const uint16_t*)(p))
+  #define   pgm_read_dword(p)   (*(const uint32_t*)(p))
+  #define   pgm_read_ptr(p)     (*(void* const*)(p))
+
+  unsigned long millis();
+  unsigned long micros();
+  void delay(unsigned long ms);
+  void yield();
+  void interrupts();
+  void noInterrupts();
+  void pinMode(uint8_t pin, uint8_t mode);
+  void digitalWrite(uint8_t pin, uint8_t value);
+
+  char* itoa(int value, char* buffer, int base);
+  char* ltoa(long value, char* buffer, int base);
+  char* utoa(unsigned value, char* buffer, int base);
+  char* dtostrf(double value, signed char width, unsigned char prec, char* buffer);
+
+  /****************************************************************************************/
+  class Print
+  {
+    public:
+      virtual ~Print() {}
+      virtual size_t write(uint8_t c) = 0;
+      virtual size_t write(const uint8_t* buffer, size_t length);
+      size_t write(const char* text) { return text==nullptr ? 0 : write((const uint8_t*)text,strlen(text)); }
+      size_t print(const char* text) { return write(text); }
+      size_t print(const __FlashStringHelper* text) { return write((const char*)text); }
+      size_t print(char c) { return write((uint8_t)c); }
+      size_t print(unsigned char value, int base=DEC) { return print((unsigned long)value,base); }
+      size_t print(int value, int base=DEC) { return print((long)value,base); }
+      size_t print(unsigned int value, int base=DEC) { return print((unsigned long)value,base); }
+      size_t print(long value, int base=DEC);
+      size_t print(unsigned long value, int base=DEC);
+      size_t print(double value, int digits=2);
+      size_t println() { return write((uint8_t)'\n'); }
+      template<typename T> size_t println(T value) { size_t n = print(value); return n+println(); }
+  };
+
+  /****************************************************************************************/
+  class HardwareSerial : public Print
+  {
+    public:
+      void begin(unsigned long baud) { (void)baud; }
+      size_t write(uint8_t c) { return putchar(c)==EOF ? 0 : 1; }
+      using Print::write;
+  };
+  extern HardwareSerial Serial;
+
+#endif   //Arduino_h
+/****************************************************************************************/
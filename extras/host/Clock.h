@@ -0,0 +1,26 @@
+/*
+ * Clock.h host stand-in for the master clock lib: the time pack only, the sketches set the time
+ *
+ *  16-X-2026 V1
+ */
+#ifndef Clock_h
+  #define Clock_h
+
+  #include  "Arduino.h"
+
+  struct TimePack {
+    uint8_t clockHour = 0;
+    uint8_t clockMin = 0;
+    uint8_t clockSec = 0;
+  } ; // end of TimePack
+
+  /****************************************************************************************/
+  class Clock
+  {
+    public:
+      Clock(TimePack &clock) { (void)clock; }
+      TimePack begin(TimePack clock) { return clock; }
+  };
+
+#endif   //Clock_h
+/****************************************************************************************/
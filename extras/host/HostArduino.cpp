@@ -0,0 +1,83 @@
+/*
+ * HostArduino.cpp host stand-in: Serial, Wire, SPI instances and the time base
+ * millis()/micros() run from the host clock plus the time passed to delay(), which does not wait
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Arduino.h"
+#include  "Wire.h"
+#include  "SPI.h"
+#include  <chrono>
+
+HardwareSerial  Serial;
+TwoWire   Wire;
+SPIClass  SPI;
+
+static const std::chrono::steady_clock::time_point HostStart = std::chrono::steady_clock::now();
+static unsigned long HostDelay = 0;                   // mS added by delay()
+
+//****************************************************************************************/
+unsigned long micros() {
+  return  (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now()-HostStart).count()+HostDelay*1000UL;
+}   // end of micros
+
+//****************************************************************************************/
+unsigned long millis() {
+  return  micros()/1000UL;
+}   // end of millis
+
+//****************************************************************************************/
+void delay(unsigned long ms) {
+  HostDelay += ms;
+}   // end of delay
+
+void yield() {}
+void interrupts() {}
+void noInterrupts() {}
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t value) { (void)pin; (void)value; }
+
+//****************************************************************************************/
+char* ltoa(long value, char* buffer, int base) {
+  snprintf(buffer,34,base==16 ? "%lx" : "%ld",value);
+  return  buffer;
+}   // end of ltoa
+
+char* itoa(int value, char* buffer, int base) { return ltoa(value,buffer,base); }
+
+char* utoa(unsigned value, char* buffer, int base) {
+  snprintf(buffer,34,base==16 ? "%x" : "%u",value);
+  return  buffer;
+}   // end of utoa
+
+char* dtostrf(double value, signed char width, unsigned char prec, char* buffer) {
+  sprintf(buffer,"%*.*f",width,prec,value);
+  return  buffer;
+}   // end of dtostrf
+
+//****************************************************************************************/
+size_t Print::write(const uint8_t* buffer, size_t length) {
+  size_t  n = 0;
+  while ( length-- ) n += write(*buffer++);
+  return  n;
+}   // end of write
+
+size_t Print::print(long value, int base) {
+  char  buffer[24];
+  snprintf(buffer,sizeof(buffer),base==HEX ? "%lX" : "%ld",value);
+  return  write(buffer);
+}   // end of print
+
+size_t Print::print(unsigned long value, int base) {
+  char  buffer[24];
+  snprintf(buffer,sizeof(buffer),base==HEX ? "%lX" : "%lu",value);
+  return  write(buffer);
+}   // end of print
+
+size_t Print::print(double value, int digits) {
+  char  buffer[40];
+  snprintf(buffer,sizeof(buffer),"%.*f",digits,value);
+  return  write(buffer);
+}   // end of print
@@ -0,0 +1,21 @@
+/*
+ * HostSketch.cpp runs an example sketch on the host: setup(), then loop() <HOST_LOOPS> times
+ * the sketch file is given by HOST_SKETCH (CMakeLists.txt); its output goes to stdout
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Arduino.h"
+#include  HOST_SKETCH
+
+#ifndef   HOST_LOOPS
+  #define HOST_LOOPS  0
+#endif  //HOST_LOOPS
+
+//****************************************************************************************/
+int main() {
+  setup();
+  for (long ii=0;ii<HOST_LOOPS;ii++) loop();
+  fflush(stdout);
+  return  0;
+}   // end of main
@@ -0,0 +1,123 @@
+/*
+ * MirrorLoopback.cpp host round trip check of the frame mirroring stream (SetMirrorOLED -> OledMirror)
+ * every flushed frame is decoded again and compared with the frame buffer of the unit (CRC-32, as
+ * FrameCRCOLED); the stream bytes per frame are reported against a full frame
+ *  - records of every style with a changing counter and time row, scroll steps and clears
+ *  - direct draws (SetCharsToRow + show), sync and async (ServiceOLED) flush
+ *  - a lost part of the stream: the decoder must ask for a key frame and be in sync after it
+ * prints -PASS when every decoded frame matches
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Oled_1306.h"
+
+static Oled_1306  RunOled(true);
+static OledMirror Viewer;                             // decoder, as on the dashboard host
+static TimePack   SysClock;
+static uint32_t   StreamBytes = 0;
+static bool       DropNext = false;                   // lose the next part of the stream
+static uint16_t   Checked = 0;
+static uint16_t   Failed = 0;
+
+//****************************************************************************************/
+static void Loopback(const uint8_t* data, uint16_t length, void* context) {
+  /*
+   * mirror sink: feed the decoder, unless this part is lost on the way
+   */
+  (void)context;
+  StreamBytes += length;
+  if ( DropNext ) {
+    DropNext = false;
+    return;
+  }
+  Viewer.Feed(data,length);
+}   // end of Loopback
+
+//****************************************************************************************/
+static uint32_t ImageCRC(const uint8_t* frame, uint16_t length) {
+  /*
+   * CRC-32 (IEEE 802.3), as Oled_1306::FrameCRCOLED
+   */
+  uint32_t  crc = 0xFFFFFFFF;
+  for (uint16_t ii=0;ii<length;ii++) {
+    crc ^= frame[ii];
+    for (uint8_t bit=0;bit<8;bit++) crc = (crc>>1) ^ (0xEDB88320 & (0-(crc&0x01)));
+  }
+  return  ~crc;
+}   // end of ImageCRC
+
+//****************************************************************************************/
+static void Check(const char* step) {
+  /*
+   * finish the frame in transfer and compare the decoded image with the frame of the unit
+   */
+  while ( RunOled.ServiceOLED() ) ;
+  if ( Viewer.NeedKey() ) {                           // stale: ask for a key frame, nothing to compare
+    RunOled.MirrorKeyOLED();
+    return;
+  }
+  Checked++;
+  uint32_t  decoded = ImageCRC(Viewer.Frame(),Viewer.Width()*(Viewer.Height()/8));
+  if ( Viewer.Width()==SCREEN_WIDTH && Viewer.Height()==SCREEN_PAGES*8 && decoded==RunOled.FrameCRCOLED() ) return;
+  Failed++;
+  printf("FAIL %s: decoded 0x%08X unit 0x%08X (%ux%u)\n",step,(unsigned)decoded,(unsigned)RunOled.FrameCRCOLED(),
+         Viewer.Width(),Viewer.Height());
+}   // end of Check
+
+//****************************************************************************************/
+int main() {
+  static const char P0[] PROGMEM = "Mirror";
+  static const char P2[] PROGMEM = "bottom";
+  static char Counter[12];
+  static char Row[] = "row text";
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  RunOled.SetMirrorOLED(Loopback,nullptr);
+  //
+  // 1. records: every style, changing payload and time, scroll steps and clears
+  //
+  for (uint16_t count=0;count<80;count++) {
+    SysClock.clockSec = count%60;
+    snprintf(Counter,sizeof(Counter),"%u",count*37);
+    RunOled.PushQueueOLED(count%8,count%5==0 ? 3 : 4,0,P0,nullptr,nullptr,Counter,P2,nullptr);
+    while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) Check("record");
+    Check("record");
+  }   // end of records
+  //
+  // 2. direct draws, async flush
+  //
+  RunOled.SetFlushModeOLED(true);
+  for (uint8_t row=0;row<4;row++) {
+    Row[0] = '0'+row;
+    RunOled.SetCharsToRow(Row,row);
+    RunOled.show();
+    Check("row");
+  }   // end of rows
+  RunOled.clear();
+  Check("clear");
+  RunOled.SetFlushModeOLED(false);
+  //
+  // 3. lost stream part: stale image, key frame, in sync again
+  //
+  uint32_t  errors = Viewer.Errors();
+  DropNext = true;
+  for (uint16_t count=0;count<6;count++) {
+    snprintf(Counter,sizeof(Counter),"lost %u",count);
+    RunOled.PushQueueOLED(4,4,0,P0,nullptr,nullptr,Counter,P2,nullptr);
+    RunOled.PopQueueDisplayOLED(SysClock);
+    if ( count==0 ) {                                   // the lost frame shows only by the next sequence
+      while ( RunOled.ServiceOLED() ) ;
+      continue;
+    }
+    Check("recovery");
+  }   // end of recovery
+  bool  recovered = Viewer.Errors()>errors && !Viewer.NeedKey();
+  if ( !recovered ) Failed++;
+  OledFlushStats  stats = RunOled.FlushStatsOLED();
+  printf("frames %u bytes/frame %u (full frame %u) decoded %u checked %u lost part %s\n",(unsigned)stats.mirrorFrames,
+         (unsigned)(stats.mirrorFrames==0 ? 0 : StreamBytes/stats.mirrorFrames),(unsigned)SCREEN_BUFSIZE,
+         (unsigned)Viewer.Frames(),Checked,recovered ? "recovered" : "NOT recovered");
+  printf("mirror round trip: failed %u %s\n",Failed,Failed==0 ? "-PASS" : "-FAIL");
+  return  Failed==0 ? 0 : 1;
+}   // end of main
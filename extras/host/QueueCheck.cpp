@@ -0,0 +1,108 @@
+/*
+ * QueueCheck.cpp host check of the display queue (PushQueueOLED/CommitQueueOLED -> PopQueueDisplayOLED)
+ * each sequence of pushes is popped to the end and the styles displayed are compared with the expected
+ * order (the style tells the records apart)
+ *  - keyed update (last writer wins) and repeated records
+ *  - keyed update after a pending flush: coalesced only with the records kept by the flush
+ *  - flush on a full lane, priority lanes
+ * prints -PASS when every sequence displays as expected
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "Oled_1306.h"
+
+static Oled_1306  RunOled(true);
+static TimePack   SysClock;
+static uint16_t   Failed = 0;
+
+//****************************************************************************************/
+static void Push(uint8_t style, bool flush, uint8_t key=0, uint8_t lane=0) {
+  /*
+   * push a record of <style> (no scroll), same payloads for all
+   */
+  static char Payload[] = "queue";
+  RunOled.PushQueueOLED(style,4,flush,"top",nullptr,nullptr,Payload,nullptr,Payload,key,lane);
+}   // end of Push
+
+//****************************************************************************************/
+static void Expect(const char* step, const uint8_t* styles, uint8_t count) {
+  /*
+   * pop the queue to the end and compare the displayed styles with <styles>
+   */
+  uint8_t shown[OLEDQUEUELEN*OLED_LANES+4];
+  uint8_t popped = 0;
+  while ( RunOled.InQueueOLED()>0 && popped<sizeof(shown) ) {
+    shown[popped++] = RunOled.PeekQueueOLED();
+    RunOled.PopQueueDisplayOLED(SysClock);
+  }
+  bool  same = popped==count;
+  for (uint8_t ii=0;same && ii<count;ii++) same = shown[ii]==styles[ii];
+  if ( same ) return;
+  Failed++;
+  printf("FAIL %s: displayed",step);
+  for (uint8_t ii=0;ii<popped;ii++) printf(" %u",shown[ii]);
+  printf(", expected");
+  for (uint8_t ii=0;ii<count;ii++) printf(" %u",styles[ii]);
+  printf("\n");
+}   // end of Expect
+
+//****************************************************************************************/
+int main() {
+  RunOled.begin(SysClock,0,0);
+  while ( RunOled.PopQueueDisplayOLED(SysClock)!=0 ) ;    // empty the initial message
+  //
+  // 1. keyed update replaces the queued record of the key; the oldest is never replaced
+  //
+  Push(4,false);
+  Push(5,false,5);
+  Push(6,false);
+  Push(7,false,5);
+  static const uint8_t Keyed[] = {4,7,6};
+  Expect("keyed",Keyed,sizeof(Keyed));
+  //
+  // 2. repeated record is dropped
+  //
+  Push(4,false);
+  Push(5,false);
+  Push(5,false);
+  static const uint8_t Repeat[] = {4,5};
+  Expect("repeat",Repeat,sizeof(Repeat));
+  //
+  // 3. keyed update after a pending flush: the record of the key before the mark is dropped with
+  //    the flush, the update is queued after the flushed record
+  //
+  Push(4,false);
+  Push(5,false,5);
+  Push(6,true);
+  Push(7,false,5);
+  static const uint8_t FlushKey[] = {6,7};
+  Expect("keyed after flush",FlushKey,sizeof(FlushKey));
+  //
+  // 4. repeated record after a pending flush
+  //
+  Push(5,false);
+  Push(6,true);
+  Push(6,false);
+  static const uint8_t FlushRepeat[] = {6};
+  Expect("repeat after flush",FlushRepeat,sizeof(FlushRepeat));
+  //
+  // 5. flush on a full lane: the record is displayed, the ones before it are dropped
+  //
+  for (uint8_t ii=0;ii<OLEDQUEUELEN;ii++) Push(4+(ii&0x01),false);
+  Push(7,true);
+  static const uint8_t FullFlush[] = {7};
+  Expect("flush when full",FullFlush,sizeof(FullFlush));
+  //
+  // 6. a higher lane is displayed first
+  //
+  #if OLED_LANES>1
+    Push(4,false);
+    Push(5,false);
+    Push(7,false,0,OLED_LANE_ALERT);
+    static const uint8_t Lanes[] = {7,4,5};
+    Expect("lanes",Lanes,sizeof(Lanes));
+  #endif  //OLED_LANES
+  printf("queue sequences: failed %u %s\n",Failed,Failed==0 ? "-PASS" : "-FAIL");
+  return  Failed==0 ? 0 : 1;
+}   // end of main
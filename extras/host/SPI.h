@@ -0,0 +1,34 @@
+/*
+ * SPI.h host stand-in: an SPI bus that counts bytes, nothing is sent
+ *
+ *  16-X-2026 V1
+ */
+#ifndef _SPI_H_INCLUDED
+  #define _SPI_H_INCLUDED
+
+  #include  "Arduino.h"
+
+  #define   MSBFIRST    1
+  #define   SPI_MODE0   0
+
+  struct SPISettings {
+    SPISettings() {}
+    SPISettings(uint32_t clock, uint8_t order, uint8_t mode) { (void)clock; (void)order; (void)mode; }
+  } ; // end of SPISettings
+
+  /****************************************************************************************/
+  class SPIClass
+  {
+    public:
+      void begin() {}
+      void beginTransaction(SPISettings settings) { (void)settings; }
+      void endTransaction() {}
+      uint8_t transfer(uint8_t data) { bytes++; return data; }
+      void transfer(void* data, size_t length) { (void)data; bytes += length; }
+      void writeBytes(const uint8_t* data, uint32_t length) { (void)data; bytes += length; }
+      uint32_t bytes = 0;
+  };
+  extern SPIClass SPI;
+
+#endif   //_SPI_H_INCLUDED
+/****************************************************************************************/
@@ -0,0 +1,22 @@
+/*
+ * Utilities.h host stand-in for the utilities lib: info stamps are not printed
+ *
+ *  16-X-2026 V1
+ */
+#ifndef Utilities_h
+  #define Utilities_h
+
+  #include  "Clock.h"
+
+  /****************************************************************************************/
+  class Utilities
+  {
+    public:
+      Utilities(TimePack &clock) { (void)clock; }
+      void InfoStamp(TimePack clock, const char* module, const char* text, int level, int option) {
+        (void)clock; (void)module; (void)text; (void)level; (void)option;
+      }
+  };
+
+#endif   //Utilities_h
+/****************************************************************************************/
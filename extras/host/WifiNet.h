@@ -0,0 +1,9 @@
+/*
+ * WifiNet.h host stand-in for the WiFi lib (not used by the display library)
+ *
+ *  16-X-2026 V1
+ */
+#ifndef WifiNet_h
+  #define WifiNet_h
+#endif   //WifiNet_h
+/****************************************************************************************/
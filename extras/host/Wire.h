@@ -0,0 +1,29 @@
+/*
+ * Wire.h host stand-in: an I2C bus that counts transactions and bytes, nothing is sent
+ *
+ *  16-X-2026 V1
+ */
+#ifndef TwoWire_h
+  #define TwoWire_h
+
+  #include  "Arduino.h"
+
+  #define   BUFFER_LENGTH   128               // as the ESP8266 core
+
+  /****************************************************************************************/
+  class TwoWire
+  {
+    public:
+      void begin() {}
+      void setClock(uint32_t clock) { (void)clock; }
+      void beginTransmission(uint8_t address) { (void)address; transactions++; }
+      size_t write(uint8_t data) { (void)data; bytes++; return 1; }
+      size_t write(const uint8_t* data, size_t length) { (void)data; bytes += length; return length; }
+      uint8_t endTransmission(bool stop=true) { (void)stop; return 0; }
+      uint32_t transactions = 0;
+      uint32_t bytes = 0;                     // bytes after the address
+  };
+  extern TwoWire Wire;
+
+#endif   //TwoWire_h
+/****************************************************************************************/
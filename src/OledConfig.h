@@ -2,15 +2,27 @@
  * OledConfig.h  is a configuraiton file for Oled_1306.h library 
  *
  * Created by Sachi Gerlitz, 25-XII-2024 ver 2
+ * 16-X-2026 ver 3 [lock free queue with priority lanes and a payload arena, cppQueue dependency removed]
  */
 
 #ifndef OledConfig_h
   #define OledConfig_h
   #ifndef Oled_1306_Version
-    #define Oled_1306_Version "2.0.3"
+    #define Oled_1306_Version "3.0.0"
   #endif  //Oled_1306_Version
   //
+  // panel geometry {128x64, 128x32, 72x40}: frame buffer, flush and rows scale with it
+  // one size per build: all the panels of a sketch (several instances at 0x3C and 0x3D, on one bus or
+  // on several) must be of this size; a panel of another size needs its own build
+  #ifndef   SCREEN_WIDTH
+    #define SCREEN_WIDTH    128       // OLED display width, in pixels
+  #endif  //SCREEN_WIDTH
+  #ifndef   SCREEN_HEIGHT
+    #define SCREEN_HEIGHT   64        // OLED display height, in pixels
+  #endif  //SCREEN_HEIGHT
+  //
   // display definitions
+  #if SCREEN_HEIGHT>=64
   // row 0
   #define OLED_Start_row_0    0       // start of row in line
   #define OLED_CharSize_row_0 2       // character size for row
@@ -23,9 +35,28 @@
   // row 3  - this is actually row 1 but half size fornt
   #define OLED_Start_row_3    16      // start of row in line
   #define OLED_CharSize_row_3 2       // character size for row
+  #else                               // 128x32, 72x40: slim rows, time on the last page
+  #define OLED_Start_row_0    0
+  #define OLED_CharSize_row_0 1
+  #define OLED_Start_row_1    8
+  #define OLED_CharSize_row_1 2
+  #define OLED_Start_row_2    (SCREEN_HEIGHT-8)
+  #define OLED_CharSize_row_2 1
+  #define OLED_Start_row_3    8
+  #define OLED_CharSize_row_3 1
+  #endif  //SCREEN_HEIGHT
   
   #define PostTestDelay  1000         // how many mS to delay post pattern test
 
+  // scheduler (TickOLED)
+  #define OLED_DwellMin   20          // min display time of a record / scroll step [100mS]
+  #define OLED_DwellMax   0           // max display time of the last record [100mS], 0 - until replaced
+  #define OLED_FrameRate  10          // max frames per second
+
+  // marquee (MarqueeOLED)
+  #define OLED_MarqueeStep  40        // mS per one column shift
+  #define OLED_MarqueeGap   3         // blank chars between marquee repeats
+
   // common messages
   static const char M00[] PROGMEM = "1234567890";
   static const char M01[] PROGMEM = "Prog start";
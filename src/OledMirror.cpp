@@ -0,0 +1,221 @@
+/*
+ * OledMirror.cpp frame mirroring stream decoder for Oled_1306
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  constructor:  OledMirror;
+ *  methods:      Feed; Reset; Frame; Pixel; Width; Height; Frames; Errors; NeedKey;
+ *
+ *  16-X-2026 V1
+ */
+
+#include  <string.h>
+#include  "OledMirror.h"
+
+#define MIRROR_HEADER   0                           // parser states
+#define MIRROR_PAGE     1
+#define MIRROR_COL0     2
+#define MIRROR_COL1     3
+#define MIRROR_CONTROL  4
+#define MIRROR_LITERAL  5
+#define MIRROR_VALUE    6
+
+//****************************************************************************************/
+OledMirror::OledMirror() {
+  /*
+   * Constructor for the mirror stream decoder
+   */
+  _frames = 0;
+  _errors = 0;
+  Reset();
+}     // end of OledMirror
+
+//****************************************************************************************/
+void OledMirror::Reset() {
+  /*
+   * method to drop the image and wait for the next key frame (e.g. after a reconnect)
+   */
+  memset(_frame,0,sizeof(_frame));
+  _state = MIRROR_HEADER;
+  _count = 0;
+  _width = 0;
+  _pages = 0;
+  _seq = 0;
+  _keyPage = 0;
+  _stale = true;
+  _skip = true;
+}   // end of Reset
+
+//****************************************************************************************/
+uint16_t OledMirror::Feed(const uint8_t* data, size_t length) {
+  /*
+   * method to decode the next part of the stream, in any split (e.g. as received from a socket)
+   * the image is updated in place; it is consistent between frames
+   * returns  number of frames completed by this part
+   */
+  uint16_t  done = 0;
+  for (size_t ii=0;ii<length;ii++) {
+    uint8_t value = data[ii];
+    switch ( _state ) {
+      case  MIRROR_HEADER:
+        if ( _count==0 && value!=OLEDMIRROR_MAGIC ) break;  // resync on the frame start
+        _header[_count++] = value;
+        if ( _count<sizeof(_header) ) break;
+        _count = 0;
+        if ( (_header[1]&~OLEDMIRROR_KEY)!=0 || _header[3]==0 || (uint16_t)_header[3]*_header[4]>OLEDMIRROR_MAXBUF ) {
+          Error();
+          break;
+        }
+        if ( _header[1]&OLEDMIRROR_KEY ) {                  // key frame: start from blank
+          _width = _header[3];
+          _pages = _header[4];
+          memset(_frame,0,sizeof(_frame));
+          _stale = false;
+          _keyPage = 0;
+        } else if ( _stale || _header[2]!=(uint8_t)(_seq+1) || _header[3]!=_width || _header[4]!=_pages ) {
+          if ( !_stale ) _errors++;                         // lost a frame
+          _stale = true;
+        }
+        _skip = _stale;
+        _seq = _header[2];
+        _state = MIRROR_PAGE;
+        break;
+      case  MIRROR_PAGE:
+        if ( value==OLEDMIRROR_END ) {                      // frame completed
+          if ( (_header[1]&OLEDMIRROR_KEY) && _keyPage!=_header[4] ) {
+            Error();                                        // key frame short: a false header on resync
+            break;
+          }
+          _state = MIRROR_HEADER;
+          if ( !_skip ) {
+            _frames++;
+            done++;
+          }
+          break;
+        }
+        if ( value>=_header[4] || ((_header[1]&OLEDMIRROR_KEY) && value!=_keyPage) ) {
+          Error();
+          break;
+        }
+        _page = value;
+        _state = MIRROR_COL0;
+        break;
+      case  MIRROR_COL0:
+        _col = value;
+        _state = MIRROR_COL1;
+        break;
+      case  MIRROR_COL1:
+        if ( value<_col || value>=_header[3] ) {
+          Error();
+          break;
+        }
+        if ( _header[1]&OLEDMIRROR_KEY ) {                  // key frame: every page whole, in order
+          if ( _col!=0 || value!=_header[3]-1 ) {
+            Error();
+            break;
+          }
+          _keyPage++;
+        }
+        _col1 = value;
+        _state = MIRROR_CONTROL;
+        break;
+      case  MIRROR_CONTROL:
+        if ( value&OLEDMIRROR_RUN ) {
+          _count = value-(OLEDMIRROR_RUN-1);
+          _state = MIRROR_VALUE;
+        } else {
+          _count = value+1;
+          _state = MIRROR_LITERAL;
+        }
+        if ( _col+_count-1>_col1 ) Error();                 // run past the window
+        break;
+      case  MIRROR_LITERAL:
+        Put(value);
+        if ( --_count==0 ) _state = _col>_col1 ? MIRROR_PAGE : MIRROR_CONTROL;
+        break;
+      case  MIRROR_VALUE:
+        while ( _count>0 ) {
+          Put(value);
+          _count--;
+        }
+        _state = _col>_col1 ? MIRROR_PAGE : MIRROR_CONTROL;
+        break;
+      default:
+        Error();
+        break;
+    }   // end of state switch
+  }   // end of byte loop
+  return  done;
+}   // end of Feed
+
+//****************************************************************************************/
+void OledMirror::Put(uint8_t value) {
+  /*
+   * method to apply one delta byte at the next column of the window
+   */
+  if ( !_skip ) _frame[_page*_width+_col] ^= value;
+  _col++;
+}   // end of Put
+
+//****************************************************************************************/
+void OledMirror::Error() {
+  /*
+   * method to drop a corrupt frame: resync on the next header, image stale until a key frame
+   */
+  _errors++;
+  _stale = true;
+  _skip = true;
+  _count = 0;
+  _state = MIRROR_HEADER;
+}   // end of Error
+
+//****************************************************************************************/
+const uint8_t* OledMirror::Frame() const {
+  /*
+   * method to return the image: <Width()> bytes per page, bit 0 of each byte on top
+   */
+  return  _frame;
+}   // end of Frame
+
+//****************************************************************************************/
+bool OledMirror::Pixel(uint8_t x, uint8_t y) const {
+  /*
+   * method to return a pixel of the image, 1 - lit
+   */
+  if ( x>=_width || (y>>3)>=_pages ) return false;
+  return  (_frame[(y>>3)*_width+x]>>(y&0x07))&0x01;
+}   // end of Pixel
+
+//****************************************************************************************/
+uint8_t OledMirror::Width() const {
+  return  _width;
+}   // end of Width
+
+//****************************************************************************************/
+uint8_t OledMirror::Height() const {
+  return  _pages*8;
+}   // end of Height
+
+//****************************************************************************************/
+uint32_t OledMirror::Frames() const {
+  /*
+   * method to return the frames applied to the image
+   */
+  return  _frames;
+}   // end of Frames
+
+//****************************************************************************************/
+uint32_t OledMirror::Errors() const {
+  /*
+   * method to return the corrupt or lost frames
+   */
+  return  _errors;
+}   // end of Errors
+
+//****************************************************************************************/
+bool OledMirror::NeedKey() const {
+  /*
+   * method to tell the image is stale: ask the unit for a key frame (Oled_1306::MirrorKeyOLED)
+   */
+  return  _stale;
+}   // end of NeedKey
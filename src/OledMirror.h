@@ -0,0 +1,75 @@
+/*
+ * OledMirror.h frame mirroring stream format and decoder for Oled_1306
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  constructor:  OledMirror;
+ *  methods:      Feed; Reset; Frame; Pixel; Width; Height; Frames; Errors; NeedKey;
+ *
+ * the decoder is plain C++ (no Arduino headers): it builds on the ESP as well as on a Linux/Windows host
+ * to rebuild the panel image of a unit from the stream sent by Oled_1306::SetMirrorOLED
+ *
+ * stream format (one frame, every value is one byte)
+ *  header      OLEDMIRROR_MAGIC, flags, sequence, width [pixels], pages [8 pixel rows]
+ *                flags bit 0 - key frame: the windows are against a blank frame (decoder clears first),
+ *                              every page whole and in page order (checked: a false header met on
+ *                              resync after a lost part is not taken for a key frame)
+ *                sequence    - +1 per frame; a gap on a delta frame means the image is stale until a key frame
+ *  window      page, first column, last column, then the window bytes XOR the previous frame, RLE coded:
+ *                control < 0x80  - (control+1) literal bytes follow
+ *                control >= 0x80 - the next byte repeats (control-0x7F) times
+ *              each page column byte holds 8 pixel rows, bit 0 on top (SSD1306 GDDRAM order)
+ *  end         OLEDMIRROR_END (in place of a window page)
+ *
+ *  16-X-2026 V1
+ */
+#ifndef OledMirror_h
+  #define OledMirror_h
+
+  #include  <stdint.h>
+  #include  <stddef.h>
+
+  #define   OLEDMIRROR_MAGIC    0xA5            // frame header start
+  #define   OLEDMIRROR_END      0xFF            // frame end, in place of a window page
+  #define   OLEDMIRROR_KEY      0x01            // header flags: key frame
+  #define   OLEDMIRROR_RUN      0x80            // RLE control: repeat run
+  #ifndef   OLEDMIRROR_MAXBUF
+    #define OLEDMIRROR_MAXBUF   1024            // largest frame the decoder takes (128x64)
+  #endif  //OLEDMIRROR_MAXBUF
+
+  /****************************************************************************************/
+  class OledMirror
+  {
+    public:
+      OledMirror();                           // constructor
+      uint16_t Feed(const uint8_t* data, size_t length);
+      void Reset();
+      const uint8_t* Frame() const;
+      bool Pixel(uint8_t x, uint8_t y) const;
+      uint8_t Width() const;
+      uint8_t Height() const;
+      uint32_t Frames() const;
+      uint32_t Errors() const;
+      bool NeedKey() const;
+    private:
+      void Error();
+      void Put(uint8_t value);
+      uint8_t _frame[OLEDMIRROR_MAXBUF];      // rebuilt panel image, page organized
+      uint8_t _header[5];
+      uint8_t _state;                         // parser state
+      uint8_t _count;                         // bytes of the header / literal / run left
+      uint8_t _width;
+      uint8_t _pages;
+      uint8_t _seq;                           // sequence of the last frame
+      uint8_t _keyPage;                       // key frame: next page expected
+      bool _stale;                            // a frame was lost, waiting for a key frame
+      bool _skip;                             // frame in progress is not applied (stale)
+      uint8_t _page;                          // window in progress
+      uint8_t _col;                           // next column of the window
+      uint8_t _col1;
+      uint32_t _frames;
+      uint32_t _errors;
+  };
+
+#endif   //OledMirror_h
+/****************************************************************************************/
@@ -0,0 +1,246 @@
+/*
+ * OledTiles.cpp text only display of the Oled_1306 layouts without a frame buffer
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  classes:      OledTiles;
+ *  methods:      begin; DisplayMemory; DisplayProg; DisplayLayout; SetCharsToRow; clear; Stats;
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "OledTiles.h"
+
+//****************************************************************************************/
+OledTiles::OledTiles(OledTransport* bus) {
+  /*
+   * Constructor for the tile text display
+   * <bus>      - transport of the panel (OledI2C, OledSPI, OledMock)
+   */
+  _bus = bus;
+  _pageValid = 0;
+  _refreshCount = 0;
+  _refreshPage = 0;
+  memset(_line,0,sizeof(_line));
+  memset(_segHash,0,sizeof(_segHash));
+  memset(&_Tiles,0,sizeof(_Tiles));
+}     // end of OledTiles
+
+//****************************************************************************************/
+bool OledTiles::begin() {
+  /*
+   * method to set up the panel (as Adafruit_SSD1306::begin, internal charge pump) and clear it
+   * returns  1 - OK; 0 - no transport
+   */
+  static const uint8_t Setup[] = {SSD1306_DISPLAYOFF, SSD1306_SETDISPLAYCLOCKDIV, 0x80,
+                                  SSD1306_SETMULTIPLEX, SCREEN_HEIGHT-1, SSD1306_SETDISPLAYOFFSET, 0x00,
+                                  SSD1306_SETSTARTLINE|0x00, SSD1306_CHARGEPUMP, 0x14,
+                                  SSD1306_MEMORYMODE, 0x00, SSD1306_SEGREMAP|0x01, SSD1306_COMSCANDEC,
+                                  SSD1306_SETCOMPINS, OledPanelGeometry::comPins,
+                                  SSD1306_SETCONTRAST, SCREEN_HEIGHT==32 ? 0x8F : 0xCF,
+                                  SSD1306_SETPRECHARGE, 0xF1, SSD1306_SETVCOMDETECT, 0x40,
+                                  SSD1306_DISPLAYALLON_RESUME, SSD1306_NORMALDISPLAY,
+                                  SSD1306_DEACTIVATE_SCROLL};
+  static const uint8_t On[] = {SSD1306_DISPLAYON};
+  if ( _bus==nullptr ) return false;
+  _bus->begin();
+  _bus->Commands(Setup,sizeof(Setup));
+  _pageValid = 0;                                         // GDDRAM content after reset is unknown
+  clear();
+  _bus->Commands(On,sizeof(On));                          // on after the GDDRAM is blank
+  return  true;
+}   // end of begin
+
+//****************************************************************************************/
+void OledTiles::DisplayMemory(TimePack _SysClock, uint8_t type, char* row0_str, char* row1_str,
+                              char* row2_str) {
+  /*
+   * method to display 3 lines from regular memory, as Oled_1306::DisplayMemory
+   * <type>       - 0 - type A  3 free lines
+   *                1 - type A  2 free lines (top and middle) and time display on bottom line
+   *                2 - type B  3 free lines
+   *                3 - type B  2 free lines (top and wrap middle line) and time display on bottom line
+   */
+  OledTextRun rows[3] = {Oled_1306::TextRunOLED(row0_str),Oled_1306::TextRunOLED(row1_str),
+                         Oled_1306::TextRunOLED(row2_str)};
+  DisplayLayout(_SysClock,Oled_1306::TypeLayout(type),rows);
+}   // end of DisplayMemory
+
+//****************************************************************************************/
+void OledTiles::DisplayProg(TimePack _SysClock, uint8_t type, const char* row0_const,
+                            const char* row1_const, const char* row2_const) {
+  /*
+   * method to display 3 lines from PROG MEM, as Oled_1306::DisplayProg
+   * <type>       - as DisplayMemory
+   */
+  OledTextRun rows[3] = {Oled_1306::TextRunOLED(row0_const,true),Oled_1306::TextRunOLED(row1_const,true),
+                         Oled_1306::TextRunOLED(row2_const,true)};
+  DisplayLayout(_SysClock,Oled_1306::TypeLayout(type),rows);
+}   // end of DisplayProg
+
+//****************************************************************************************/
+void OledTiles::DisplayLayout(TimePack _SysClock, const OledLayoutDef* layout, const OledTextRun* rows) {
+  /*
+   * method to display the rows of a layout (a built in style layout or one of the application),
+   * each page composed from the row tiles on it and sent unless the panel has it already
+   * <rows>       - text run per row 0..2 (empty - row left empty)
+   * row starts are rounded down to a page, text sizes limited to {1,2,3}
+   */
+  if ( layout==nullptr ) return;                          // error
+  if ( layout->flags&OLED_LAYOUT_CLEAR ) {
+    clear();
+    return;
+  }
+  for (uint8_t ii=0;ii<3;ii++) {
+    if ( rows[ii].text!=nullptr && rows[ii].length>PAYLOADMAXLEN ) return;     // error
+  }
+  Refresh();
+  OledRowDef  geometry[4];
+  OledTextRun runs[4];
+  uint8_t     count = 0;
+  char        time[11];
+  for (uint8_t ii=0;ii<3;ii++) {                          // rows of the layout, unused rows skipped
+    if ( layout->row[ii].size==0 ) continue;
+    geometry[count] = layout->row[ii];
+    runs[count] = ii==0 && layout->header!=nullptr ? Oled_1306::TextRunOLED(layout->header,true) : rows[ii];
+    if ( runs[count].text==nullptr ) runs[count].length = 0;
+    count++;
+  }   // end of row loop
+  if ( layout->flags&OLED_LAYOUT_CLOCK ) {                // time on the bottom row
+    static constexpr OledRowDef TimeRow = OLED_ROW_2;
+    Oled_1306::FormatTime(time,_SysClock.clockHour,_SysClock.clockMin,_SysClock.clockSec);
+    geometry[count] = TimeRow;
+    runs[count] = Oled_1306::TextRunOLED(time);
+    count++;
+  }
+  for (uint8_t page=0;page<SCREEN_PAGES;page++) {
+    memset(_line,0,sizeof(_line));
+    for (uint8_t ii=0;ii<count;ii++) Compose(page,geometry[ii],runs[ii]);
+    SendPage(page);
+  }   // end of page loop
+  _Tiles.updates++;
+}   // end of DisplayLayout
+
+//****************************************************************************************/
+void OledTiles::SetCharsToRow(char* buffer, uint8_t row) {
+  /*
+   * method to display chars on row {0,1,2,3} at once (there is no show())
+   * the pages of the row are replaced: other rows sharing them (row 1 and row 3) are cleared
+   * <buffer> - chars ending with 0x00, up to <PAYLOADMAXLEN>
+   */
+  uint8_t start;
+  uint8_t size;
+  OledTextRun run = Oled_1306::TextRunOLED(buffer);
+  if ( run.text==nullptr || run.length>PAYLOADMAXLEN ) return;    // error
+  if ( !Oled_1306::RowGeometry(row,start,size) ) return;  // error
+  Refresh();
+  OledRowDef  geometry = {start,size,false};
+  uint8_t     last = Compose(0xFF,geometry,run);          // pages the text reaches
+  for (uint8_t page=start>>3;page<=last;page++) {
+    memset(_line,0,sizeof(_line));
+    Compose(page,geometry,run);
+    SendPage(page);
+  }   // end of page loop
+  _Tiles.updates++;
+}   // end of SetCharsToRow
+
+//****************************************************************************************/
+void OledTiles::clear() {
+  /*
+   * method to blank the panel (only pages not blank already are sent)
+   */
+  memset(_line,0,sizeof(_line));
+  for (uint8_t page=0;page<SCREEN_PAGES;page++) SendPage(page);
+}   // end of clear
+
+//****************************************************************************************/
+OledTileStats OledTiles::Stats() {
+  /*
+   * method to return the tile counters; the bus bytes are in the transport (OledTransport::Stats)
+   */
+  return  _Tiles;
+}   // end of Stats
+
+//****************************************************************************************/
+uint8_t OledTiles::Compose(uint8_t page, const OledRowDef &row, const OledTextRun &run) {
+  /*
+   * method to OR the glyph tiles of a row that fall on GDDRAM <page> into the page buffer
+   * chars are placed as Oled_1306::BlitText (wrap and new line as Adafruit_GFX)
+   * <page>   - page to compose, 0xFF - none (extent only)
+   * returns  the last page the row reaches
+   */
+  uint8_t size = row.size<1 ? 1 : (row.size>3 ? 3 : row.size);
+  int16_t x = 0;
+  int16_t y = row.start&0xF8;
+  for (uint8_t ii=0;ii<run.length;ii++) {
+    uint8_t c = run.pgm ? pgm_read_byte(run.text+ii) : run.text[ii];
+    if ( c=='\n' ) {                                      // new line as GFX
+      x = 0;
+      y += size*8;
+      continue;
+    }
+    if ( c=='\r' ) continue;
+    if ( x+size*6>SCREEN_WIDTH ) {                        // wrap as GFX
+      x = 0;
+      y += size*8;
+    }
+    uint8_t top = y>>3;
+    if ( y<SCREEN_HEIGHT && page>=top && page<top+size ) {  // the glyph has a tile on the page
+      uint8_t shift = (page-top)*8;
+      for (uint8_t col=0;col<5;col++) {                   // 6th column is blank
+        uint8_t bits = Oled_1306::GlyphColumn(c,col,size)>>shift;
+        for (uint8_t sx=0;sx<size;sx++) {                 // scale horizontally
+          int16_t cx = x+col*size+sx;
+          if ( cx>=SCREEN_WIDTH ) break;
+          _line[cx] |= bits;
+        }
+      }   // end of glyph columns
+    }   // end of tile
+    x += size*6;
+  }   // end of text
+  uint8_t last = (y>>3)+size-1;
+  return  last<SCREEN_PAGES ? last : SCREEN_PAGES-1;
+}   // end of Compose
+
+//****************************************************************************************/
+void OledTiles::Refresh() {
+  /*
+   * method to count an update and, every <OLED_TILEREFRESH> updates, mark the next page (in turn) as
+   * unknown: it is sent whole when composed next, correcting a segment missed by a hash collision
+   */
+  if ( OLED_TILEREFRESH==0 || ++_refreshCount<OLED_TILEREFRESH ) return;
+  _refreshCount = 0;
+  _pageValid &= ~(1<<_refreshPage);
+  _refreshPage = _refreshPage+1<SCREEN_PAGES ? _refreshPage+1 : 0;
+}   // end of Refresh
+
+//****************************************************************************************/
+void OledTiles::SendPage(uint8_t page) {
+  /*
+   * method to send the page buffer as GDDRAM <page>: the columns from the first to the last segment
+   * that differs from the panel, nothing when all are the same
+   */
+  bool    valid = _pageValid&(1<<page);
+  uint8_t first = OLED_TILESEGS;
+  uint8_t last = 0;
+  for (uint8_t seg=0;seg<OLED_TILESEGS;seg++) {
+    uint8_t   col1 = (seg+1)*OLED_TILESEG<SCREEN_WIDTH ? (seg+1)*OLED_TILESEG : SCREEN_WIDTH;
+    uint32_t  hash = 2166136261UL;                        // FNV-1a
+    for (uint8_t ii=seg*OLED_TILESEG;ii<col1;ii++) hash = (hash^_line[ii])*16777619UL;
+    if ( valid && _segHash[page][seg]==hash ) continue;
+    _segHash[page][seg] = hash;
+    if ( first==OLED_TILESEGS ) first = seg;
+    last = seg;
+  }   // end of segment loop
+  if ( first==OLED_TILESEGS ) {
+    _Tiles.pagesSkipped++;
+    _Tiles.bytesSkipped += SCREEN_WIDTH;
+    return;
+  }
+  uint8_t col0 = first*OLED_TILESEG;
+  uint8_t col1 = (last+1)*OLED_TILESEG<SCREEN_WIDTH ? (last+1)*OLED_TILESEG-1 : SCREEN_WIDTH-1;
+  _bus->Window(page,OledPanelGeometry::colOffset+col0,OledPanelGeometry::colOffset+col1,&_line[col0],SCREEN_PAGES);
+  _pageValid |= 1<<page;
+  _Tiles.pagesSent++;
+  _Tiles.bytesSkipped += SCREEN_WIDTH-(col1-col0+1);
+}   // end of SendPage
@@ -0,0 +1,73 @@
+/*
+ * OledTiles.h text only display of the Oled_1306 layouts without a frame buffer
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  classes:      OledTiles;
+ *  methods:      begin; DisplayMemory; DisplayProg; DisplayLayout; SetCharsToRow; clear; Stats;
+ *
+ * the rows of a layout (OledConfig.h, OledLayoutDef) are rendered as page aligned glyph tiles, text size
+ * {1,2,3}, one GDDRAM page at a time into a page buffer and sent by the transport; no Adafruit_SSD1306
+ * frame buffer and no shadow copy are kept (RAM: a page and a hash per page segment)
+ *  - each page is compared with the one sent last by a hash per <OLED_TILESEG> columns: only the
+ *    columns from the first to the last changed segment are sent
+ *  - the hash (FNV-1a, 32 bit) may collide: a changed segment with the hash of the old content is not
+ *    sent. Every <OLED_TILEREFRESH> updates one page is sent whole (pages in turn), so such a segment is
+ *    corrected within <OLED_TILEREFRESH>*pages updates
+ *  - text is drawn as the Oled_1306 fast text (classic font, wrap as Adafruit_GFX); no graphics,
+ *    marquee, hardware scroll or queue
+ *  - the bus is started by the application (Wire.begin(); SPI: SPI.begin() and the D/C, CS pins as
+ *    outputs); the panel reset pin is not driven
+ *
+ *  16-X-2026 V1
+ */
+#ifndef OledTiles_h
+  #define OledTiles_h
+
+  #include  "Oled_1306.h"
+
+  #ifndef   OLED_TILESEG
+    #define OLED_TILESEG  16                // columns per page segment compared before sending
+  #endif  //OLED_TILESEG
+  #define   OLED_TILESEGS ((SCREEN_WIDTH+OLED_TILESEG-1)/OLED_TILESEG)
+  #ifndef   OLED_TILEREFRESH
+    #define OLED_TILEREFRESH  32            // updates between pages sent whole (hash collisions), 0 - never
+  #endif  //OLED_TILEREFRESH
+
+  // tile statistics
+  struct OledTileStats {
+    uint32_t updates;                       // screens and rows rendered
+    uint32_t pagesSent;                     // GDDRAM pages sent (changed columns only)
+    uint32_t pagesSkipped;                  // pages not sent, same as on the panel
+    uint32_t bytesSkipped;                  // page bytes not sent, same as on the panel
+  } ; // end of OledTileStats
+
+  /****************************************************************************************/
+  class OledTiles
+  {
+    public:
+      OledTiles(OledTransport* bus);
+      bool begin();
+      void DisplayMemory(TimePack _SysClock, uint8_t type, char* row0_str, char* row1_str=nullptr,
+                    char* row2_str=nullptr);
+      void DisplayProg(TimePack _SysClock, uint8_t type, const char* row0_const=nullptr,
+                    const char* row1_const=nullptr, const char* row2_const=nullptr);
+      void DisplayLayout(TimePack _SysClock, const OledLayoutDef* layout, const OledTextRun* rows);
+      void SetCharsToRow(char* buffer, uint8_t row);
+      void clear();
+      OledTileStats Stats();
+    private:
+      uint8_t Compose(uint8_t page, const OledRowDef &row, const OledTextRun &run);
+      void SendPage(uint8_t page);
+      void Refresh();
+      OledTransport* _bus;
+      uint8_t _line[SCREEN_WIDTH];          // page being composed
+      uint32_t _segHash[SCREEN_PAGES][OLED_TILESEGS];   // content hash of the page segments on the panel
+      uint16_t _pageValid;                  // bit per page: <_segHash> known
+      uint16_t _refreshCount;               // updates since a page was sent whole
+      uint8_t _refreshPage;                 // page to send whole next
+      OledTileStats _Tiles;
+  };
+
+#endif   //OledTiles_h
+/****************************************************************************************/
@@ -0,0 +1,259 @@
+/*
+ * OledTransport.cpp bus transports for the Oled_1306 frame flush
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  classes:      OledTransport (base); OledI2C; OledSPI; OledMock;
+ *  methods:      begin; Commands; Data; Window; Invalidate; Stats; Count;
+ *                Gddram (OledMock)
+ *
+ *  16-X-2026 V1
+ */
+
+#include  "OledTransport.h"
+#include  "Adafruit_SSD1306.h"
+
+//****************************************************************************************/
+OledTransport::OledTransport() {
+  /*
+   * Constructor for the transport base
+   */
+  memset(&_Bus,0,sizeof(_Bus));
+  _nextPage = 0xFF;
+  _nextCol0 = 0;
+  _nextCol1 = 0;
+}     // end of OledTransport
+
+//****************************************************************************************/
+bool OledTransport::begin() {
+  /*
+   * method to prepare the bus; the bus itself is started by Adafruit_SSD1306::begin
+   * returns  1 - OK
+   */
+  Invalidate();
+  return  true;
+}   // end of begin
+
+//****************************************************************************************/
+void OledTransport::Window(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data, uint8_t pages) {
+  /*
+   * method to write one GDDRAM window (single page, columns <col0>..<col1>)
+   * the page range is left open to the last page, so after the window the GDDRAM pointer is at
+   * <col0> of the next page: a window there with the same columns is sent as data only
+   * <pages>  - panel height in pages
+   */
+  if ( page!=_nextPage || col0!=_nextCol0 || col1!=_nextCol1 ) {  // set the address window
+    uint8_t commands[6] = {SSD1306_PAGEADDR, page, (uint8_t)(pages-1), SSD1306_COLUMNADDR, col0, col1};
+    Commands(commands,sizeof(commands));
+    _nextCol0 = col0;
+    _nextCol1 = col1;
+  }
+  Data(data,col1-col0+1);
+  _nextPage = page+1<pages ? page+1 : 0xFF;
+}   // end of Window
+
+//****************************************************************************************/
+void OledTransport::Invalidate() {
+  /*
+   * method to forget the GDDRAM pointer (other commands were sent to the panel)
+   */
+  _nextPage = 0xFF;
+}   // end of Invalidate
+
+//****************************************************************************************/
+OledBusStats OledTransport::Stats() {
+  /*
+   * method to return the bus counters
+   */
+  return  _Bus;
+}   // end of Stats
+
+//****************************************************************************************/
+void OledTransport::Count(uint32_t transactions, uint32_t bytes, uint32_t payload) {
+  /*
+   * method to add traffic sent outside the transport (e.g. Adafruit_SSD1306::display)
+   */
+  _Bus.transactions += transactions;
+  _Bus.bytes += bytes;
+  _Bus.payload += payload;
+}   // end of Count
+
+//****************************************************************************************/
+OledI2C::OledI2C(TwoWire* wire, uint8_t address, uint8_t chunk) {
+  /*
+   * Constructor for the I2C transport
+   * <wire>     - I2C bus
+   * <address>  - panel address (0x3C, 0x3D)
+   * <chunk>    - data bytes per transaction, up to the Wire buffer size less the control byte
+   */
+  _wire = wire;
+  _address = address;
+  _chunk = chunk==0 ? OLED_I2CCHUNK : chunk;
+}     // end of OledI2C
+
+//****************************************************************************************/
+void OledI2C::SetAddress(uint8_t address) {
+  _address = address;
+}   // end of SetAddress
+
+//****************************************************************************************/
+void OledI2C::Commands(const uint8_t* commands, uint8_t length) {
+  /*
+   * method to send commands in one transaction (Co=0, D/C=0: command stream)
+   */
+  _wire->setClock(OLED_I2CCLOCK);
+  _wire->beginTransmission(_address);
+  _wire->write((uint8_t)0x00);
+  _wire->write(commands,length);
+  _wire->endTransmission();
+  _wire->setClock(OLED_I2CRESTORE);
+  _Bus.transactions++;
+  _Bus.bytes += 2+length;                                 // address and control bytes
+}   // end of Commands
+
+//****************************************************************************************/
+void OledI2C::Data(const uint8_t* data, uint16_t length) {
+  /*
+   * method to send GDDRAM data (Co=0, D/C=1: data stream) in chunks of the Wire buffer size
+   */
+  _wire->setClock(OLED_I2CCLOCK);
+  while ( length>0 ) {
+    uint16_t  chunk = length>_chunk ? _chunk : length;
+    _wire->beginTransmission(_address);
+    _wire->write((uint8_t)0x40);
+    _wire->write(data,chunk);
+    _wire->endTransmission();
+    _Bus.transactions++;
+    _Bus.bytes += 2+chunk;
+    _Bus.payload += chunk;
+    data += chunk;
+    length -= chunk;
+  }   // end of data loop
+  _wire->setClock(OLED_I2CRESTORE);
+}   // end of Data
+
+//****************************************************************************************/
+OledSPI::OledSPI(SPIClass* spi, int8_t dc, int8_t cs, uint32_t clock) {
+  /*
+   * Constructor for the SPI transport (pins are set up by Adafruit_SSD1306::begin)
+   * <dc>       - data/command pin
+   * <cs>       - chip select pin, -1 - not used
+   */
+  _spi = spi;
+  _dc = dc;
+  _cs = cs;
+  _clock = clock;
+}     // end of OledSPI
+
+//****************************************************************************************/
+void OledSPI::Select(bool data) {
+  _spi->beginTransaction(SPISettings(_clock,MSBFIRST,SPI_MODE0));
+  digitalWrite(_dc,data ? HIGH : LOW);
+  if ( _cs>=0 ) digitalWrite(_cs,LOW);
+}   // end of Select
+
+//****************************************************************************************/
+void OledSPI::Release() {
+  if ( _cs>=0 ) digitalWrite(_cs,HIGH);
+  _spi->endTransaction();
+}   // end of Release
+
+//****************************************************************************************/
+void OledSPI::Commands(const uint8_t* commands, uint8_t length) {
+  /*
+   * method to send commands in one chip select frame
+   */
+  Select(false);
+  for (uint8_t ii=0;ii<length;ii++) _spi->transfer(commands[ii]);
+  Release();
+  _Bus.transactions++;
+  _Bus.bytes += length;
+}   // end of Commands
+
+//****************************************************************************************/
+void OledSPI::Data(const uint8_t* data, uint16_t length) {
+  /*
+   * method to send GDDRAM data in one chip select frame
+   */
+  Select(true);
+  #if defined(ESP8266) || defined(ESP32)
+    _spi->writeBytes(data,length);                        // no receive buffer needed
+  #else
+    for (uint16_t ii=0;ii<length;ii++) _spi->transfer(data[ii]);
+  #endif
+  Release();
+  _Bus.transactions++;
+  _Bus.bytes += length;
+  _Bus.payload += length;
+}   // end of Data
+
+//****************************************************************************************/
+OledMock::OledMock() {
+  /*
+   * Constructor for the mock transport: an SSD1306 in horizontal addressing mode
+   */
+  memset(_gddram,0,sizeof(_gddram));
+  _page0 = 0;
+  _page1 = 7;
+  _col0 = 0;
+  _col1 = 127;
+  _page = 0;
+  _col = 0;
+  _command = 0;
+  _args = 0;
+}     // end of OledMock
+
+//****************************************************************************************/
+void OledMock::Commands(const uint8_t* commands, uint8_t length) {
+  /*
+   * method to take the address commands (PAGEADDR, COLUMNADDR); other commands are counted only
+   */
+  for (uint8_t ii=0;ii<length;ii++) {
+    uint8_t value = commands[ii];
+    if ( _command==SSD1306_PAGEADDR ) {
+      if ( _args++==0 ) _page0 = _page = value&0x07;
+      else {
+        _page1 = value&0x07;
+        _command = 0;
+      }
+    } else if ( _command==SSD1306_COLUMNADDR ) {
+      if ( _args++==0 ) _col0 = _col = value&0x7F;
+      else {
+        _col1 = value&0x7F;
+        _command = 0;
+      }
+    } else if ( value==SSD1306_PAGEADDR || value==SSD1306_COLUMNADDR ) {
+      _command = value;
+      _args = 0;
+    }
+  }   // end of command loop
+  _Bus.transactions++;
+  _Bus.bytes += length;
+}   // end of Commands
+
+//****************************************************************************************/
+void OledMock::Data(const uint8_t* data, uint16_t length) {
+  /*
+   * method to write data at the GDDRAM pointer, wrapping in the address window
+   */
+  for (uint16_t ii=0;ii<length;ii++) {
+    _gddram[_page*128+_col] = data[ii];
+    if ( _col<_col1 ) {
+      _col++;
+      continue;
+    }
+    _col = _col0;
+    _page = _page<_page1 ? _page+1 : _page0;
+  }   // end of data loop
+  _Bus.transactions++;
+  _Bus.bytes += length;
+  _Bus.payload += length;
+}   // end of Data
+
+//****************************************************************************************/
+const uint8_t* OledMock::Gddram() const {
+  /*
+   * method to return the panel image: 128 bytes per page, bit 0 of each byte on top
+   */
+  return  _gddram;
+}   // end of Gddram
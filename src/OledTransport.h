@@ -0,0 +1,117 @@
+/*
+ * OledTransport.h bus transports for the Oled_1306 frame flush
+ * Created by Sachi Gerlitz
+ *
+ * in this file
+ *  classes:      OledTransport (base); OledI2C; OledSPI; OledMock;
+ *  methods:      begin; Commands; Data; Window; Invalidate; Stats; Count;
+ *                Gddram (OledMock)
+ *
+ * the transport carries the GDDRAM windows of a flush (Oled_1306::FlushOLED); panel set up and the
+ * hardware scroll commands still go through Adafruit_SSD1306
+ *  - commands of a window are merged into one transaction
+ *  - data is sent in the largest chunks the bus driver takes
+ *  - a full width window following the previous one on the next page needs no address commands
+ *    (the GDDRAM pointer wraps to it), so a full frame is one address set and a data stream
+ *
+ *  16-X-2026 V1
+ */
+#ifndef OledTransport_h
+  #define OledTransport_h
+
+  #include  "Arduino.h"
+  #include  "Wire.h"
+  #include  "SPI.h"
+
+  #ifndef OLED_I2CCLOCK
+    #define OLED_I2CCLOCK   400000UL                  // I2C clock during transfer (as Adafruit_SSD1306)
+  #endif  //OLED_I2CCLOCK
+  #ifndef OLED_I2CRESTORE
+    #define OLED_I2CRESTORE 100000UL                  // I2C clock restored after transfer
+  #endif  //OLED_I2CRESTORE
+  #ifndef OLED_I2CCHUNK                               // Wire transmit buffer; one byte is the control byte
+    #ifdef  BUFFER_LENGTH
+      #define OLED_I2CCHUNK (BUFFER_LENGTH-1)
+    #else
+      #define OLED_I2CCHUNK 31
+    #endif  //BUFFER_LENGTH
+  #endif  //OLED_I2CCHUNK
+  #ifndef OLED_SPICLOCK
+    #define OLED_SPICLOCK   8000000UL                 // SPI clock (as Adafruit_SSD1306)
+  #endif  //OLED_SPICLOCK
+
+  // bus statistics
+  struct OledBusStats {
+    uint32_t transactions;                  // bus transactions (I2C start..stop, SPI CS low..high)
+    uint32_t bytes;                         // bytes on the bus (address, control, command and data)
+    uint32_t payload;                       // GDDRAM data bytes
+  } ; // end of OledBusStats
+
+  /****************************************************************************************/
+  class OledTransport
+  {
+    public:
+      OledTransport();
+      virtual ~OledTransport() {}
+      virtual bool begin();
+      virtual void Commands(const uint8_t* commands, uint8_t length) = 0;
+      virtual void Data(const uint8_t* data, uint16_t length) = 0;
+      void Window(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data, uint8_t pages);
+      void Invalidate();
+      OledBusStats Stats();
+      void Count(uint32_t transactions, uint32_t bytes, uint32_t payload);
+    protected:
+      OledBusStats _Bus;
+      uint8_t _nextPage;                    // page the GDDRAM pointer wrapped to, 0xFF - unknown
+      uint8_t _nextCol0;                    // column window set on the panel
+      uint8_t _nextCol1;
+  };
+
+  /****************************************************************************************/
+  class OledI2C : public OledTransport
+  {                                         // I2C: control byte 0x00 - command stream, 0x40 - data stream
+    public:
+      OledI2C(TwoWire* wire, uint8_t address, uint8_t chunk=OLED_I2CCHUNK);
+      void Commands(const uint8_t* commands, uint8_t length);
+      void Data(const uint8_t* data, uint16_t length);
+      void SetAddress(uint8_t address);
+    private:
+      TwoWire* _wire;
+      uint8_t _address;
+      uint8_t _chunk;                       // data bytes per transaction
+  };
+
+  /****************************************************************************************/
+  class OledSPI : public OledTransport
+  {                                         // 4 wire SPI: D/C pin low - commands, high - data
+    public:
+      OledSPI(SPIClass* spi, int8_t dc, int8_t cs, uint32_t clock=OLED_SPICLOCK);
+      void Commands(const uint8_t* commands, uint8_t length);
+      void Data(const uint8_t* data, uint16_t length);
+    private:
+      void Select(bool data);
+      void Release();
+      SPIClass* _spi;
+      int8_t _dc;
+      int8_t _cs;
+      uint32_t _clock;
+  };
+
+  /****************************************************************************************/
+  class OledMock : public OledTransport
+  {                                         // host / test transport: keeps the GDDRAM image the panel would have
+    public:
+      OledMock();
+      void Commands(const uint8_t* commands, uint8_t length);
+      void Data(const uint8_t* data, uint16_t length);
+      const uint8_t* Gddram() const;
+    private:
+      uint8_t _gddram[1024];                // 128x64
+      uint8_t _page0, _page1, _col0, _col1; // address window
+      uint8_t _page, _col;                  // GDDRAM pointer
+      uint8_t _command;                     // command waiting for arguments
+      uint8_t _args;                        // arguments received
+  };
+
+#endif   //OledTransport_h
+/****************************************************************************************/
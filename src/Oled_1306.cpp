@@ -6,8 +6,16 @@
  *  constructor:  Oled1306;
  *  methods:      begin; PopQueueDisplayOLED; PushQueueOLED; DisplayMemory; DisplayMix; DisplayLine; SetTimeToRow2;
  *                DrawLinePattern; DrawRecPattern; clear; show; InQueueOLED; getVersion;
- *                PeekQueueOLED; DisplayProg; SetCharsToRow;
+ *                PeekQueueOLED; DisplayProg; SetCharsToRow; FlushOLED; FlushStatsOLED;
+ *                ServiceOLED; BusyOLED; SetFlushModeOLED; SetFastTextOLED;
+ *                ReserveQueueOLED; CommitQueueOLED; QueueStatsOLED; SetLiveClockOLED;
+ *                TickOLED; SetDwellOLED; SetFrameRateOLED; MarqueeOLED; StopMarqueeOLED; SetMarqueeOLED;
+ *                ServiceAllOLED; StatsOLED; ResetStatsOLED; SetMirrorOLED; MirrorKeyOLED;
+ *                SetDoubleBufferOLED; SetTransportOLED; FrameCRCOLED; FrameOLED; PayloadQueueOLED;
+ *                TextRunOLED; DrawRunOLED; SetRenderCacheOLED; StartOLED; StartStepOLED;
+ *                SetStyleOLED; ScreenOLED; SetFieldOLED; RefreshScreenOLED;
  * 
+ *  V3  16-X-2026     [lock free queue with priority lanes, cppQueue dependency removed]
  *  V2  29-XII-2024   [improved reset, delay as parameter]
  *  V1  10-VII-2024
  * 
@@ -17,6 +25,7 @@
  *              |                        lines 11 chars |
  *              | line 2 up to 11 chars                 |
  *              +---------------------------------------+
+ *              (128x64; on 128x32 and 72x40 panels the rows are slim, see OledConfig.h)
  * Common settings
  *  <scroll>    action               
  *    4         display freeze
@@ -42,33 +51,184 @@
  *                        max 11 c.   max 7 c.
  *    7     full nar NS   payload0    payload1    payload2  set     stop
  *                        max 11 c.   2 narrow lines
+ *    8..   custom        as the layout set by SetStyleOLED (OledLayoutDef), up to <OLED_CUSTOMSTYLES>
  * 
  */
 
 #include  "Oled_1306.h"
+#include  "glcdfont.c"                              // Adafruit_GFX classic 5x7 font (static copy, fast text and tiles)
+                                                    // glyph column bit expansion per nibble for text size 2 and 3
+static const uint8_t  OLED_Scale2[16] PROGMEM = {0x00,0x03,0x0C,0x0F,0x30,0x33,0x3C,0x3F,
+                                                 0xC0,0xC3,0xCC,0xCF,0xF0,0xF3,0xFC,0xFF};
+static const uint16_t OLED_Scale3[16] PROGMEM = {0x000,0x007,0x038,0x03F,0x1C0,0x1C7,0x1F8,0x1FF,
+                                                 0xE00,0xE07,0xE38,0xE3F,0xFC0,0xFC7,0xFF8,0xFFF};
 
 TimePack  _SysClock_Oled ;
 Utilities _RunUtil_Oled(_SysClock_Oled);            // Utilities instance
-                                                    // DS1306 Screen declaration
-#define SCREEN_WIDTH    128                         // OLED display width, in pixels
-#define SCREEN_HEIGHT   64                          // OLED display height, in pixels
-#define OLED_RESET      -1                          // Reset pin # (or -1 if sharing Arduino reset pin)
-#define SCREEN_ADDRESS  0x3C                        //< See datasheet for Address; 0x3D for 128x64, 0x3C for 128x32
 #define OLEDSTARTDELAY  500                         // 500mS delay for stability
-Adafruit_SSD1306 OLED_display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);  // display instance
+                                                    // panels registered for the bus arbiter (ServiceAllOLED)
+Oled_1306*  Oled_1306::_Panels[OLED_PANELS] = {};
+uint8_t     Oled_1306::_panelCount = 0;
+uint8_t     Oled_1306::_panelNext = 0;
 
-OledStackDef  OLEDqueue;                            // actual stack
-cppQueue ShowOLED (sizeof(OledStackDef), OLEDQUEUELEN,  IMPLEMENTATION); // Input instantiate queue
+                                                    // display queue (per instance): single producer / single consumer ring
+                                                    // one slot kept free to tell full from empty
+#define OLED_LANELEN(lane)  ((lane)==0 ? OLEDQUEUELEN : OLED_ALERTQUEUELEN)     // records per lane
+#define OLED_LANEBASE(lane) ((lane)==0 ? 0 : OLEDQUEUELEN+1+((lane)-1)*(OLED_ALERTQUEUELEN+1))  // first slot in <_Ring>
+#define OLED_NEXT(i,lane)   ((i)>=OLED_LANELEN(lane) ? 0 : (i)+1)
+#define OLED_DEPTH(head,tail,lane)  (((head)+OLED_LANELEN(lane)+1-(tail)) % (OLED_LANELEN(lane)+1))
+#define OLED_BARRIER()  __sync_synchronize()        // slot content visible before the index update
+                                                    // next display source (NextSource): lane {0,...,OLED_LANES-1} or
+#define OLED_NEXT_SCROLL  8                         // next scroll step of the record on display
+#define OLED_NEXT_EMPTY   9                         // nothing to display
+#define OLED_NEXT_RESUME  16                        // +lane: interrupted record of the lane
+                                                    // built in layouts per style (see table above), resolved at
+                                                    // compile time from the row geometry of OledConfig.h
+static constexpr OledLayoutDef OLED_Layouts[OLED_STYLES] = {
+  {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_NONE},nullptr,OLED_LAYOUT_CLOCK},  // 0 default: top,middle,time
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_NONE},M03,OLED_LAYOUT_CLOCK},      // 1 IP head, 2 lines IP, time
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_NONE},nullptr,OLED_LAYOUT_CLOCK},  // 2 top,2 middle, time
+  {{OLED_ROW_NONE,OLED_ROW_NONE,OLED_ROW_NONE},nullptr,OLED_LAYOUT_CLEAR},  // 3 clear display
+  {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_2},nullptr,0},                     // 4 top,middle, bottom
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_2},nullptr,0},                     // 5 top,2 middle, bottom
+  {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_2},nullptr,0},                     // 6 as 4
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_2},nullptr,0}                      // 7 as 5
+};
+                                                    // layouts of DisplayMemory/DisplayProg <type> {0,...,4}
+static constexpr OledLayoutDef OLED_Types[5] = {
+  {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_2},nullptr,0},                     // 0 type A 3 lines
+  {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_NONE},nullptr,OLED_LAYOUT_CLOCK},  // 1 type A 2 lines and time
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_2},nullptr,0},                     // 2 type B 3 lines
+  {{OLED_ROW_0,OLED_ROW_3,OLED_ROW_NONE},nullptr,OLED_LAYOUT_CLOCK},  // 3 type B 2 lines and time
+  {{OLED_ROW_0,OLED_ROW_NONE,OLED_ROW_NONE},nullptr,0}                // 4 top line only
+};
+                                                    // geometry of rows {0,1,2,3} (SetCharsToRow, MarqueeOLED)
+static constexpr OledRowDef OLED_Rows[4] = {OLED_ROW_0,OLED_ROW_1,OLED_ROW_2,OLED_ROW_3};
 
 //****************************************************************************************/
-Oled_1306::Oled_1306(bool activate) {
+Oled_1306::Oled_1306(bool activate, uint8_t address, TwoWire* wire) :
+                    _display(SCREEN_WIDTH, SCREEN_HEIGHT, wire, OLED_RESET),
+                    _i2c(wire, address), _spi(&SPI, -1, -1) {
   /*
    * Constructor for OLED 1306 library
    * <activate>   - 0 - disbale library (1306 does not exist)
    *              - 1 - activate library
+   * <address>    - panel I2C address (0x3C or 0x3D)
+   * <wire>       - I2C bus of the panel (&Wire, or a second TwoWire instance)
+   * each instance has its own frame buffer, shadow, queue and statistics; the font tables are shared
    */
+  _busOwn = &_i2c;
+  Init(activate,address);
+}     // end of Oled_1306
+
+//****************************************************************************************/
+Oled_1306::Oled_1306(bool activate, SPIClass* spi, int8_t dc, int8_t rst, int8_t cs) :
+                    _display(SCREEN_WIDTH, SCREEN_HEIGHT, spi, dc, rst, cs),
+                    _i2c(&Wire, SCREEN_ADDRESS), _spi(spi, dc, cs) {
+  /*
+   * Constructor for OLED 1306 library, SPI panel
+   * <spi>        - SPI bus (&SPI)
+   * <dc>/<rst>/<cs> - data/command, reset and chip select pins (-1 - not connected)
+   */
+  _busOwn = &_spi;
+  Init(activate,SCREEN_ADDRESS);
+}     // end of Oled_1306
+
+//****************************************************************************************/
+void Oled_1306::Init(bool activate, uint8_t address) {
+  /*
+   * method to set up the instance state (both constructors)
+   */
+  _bus = _busOwn;
   _activate = activate;
-}     // end of Clock 
+  _spare = nullptr;
+  _startState = OLED_START_DONE;
+  _cache = nullptr;
+  _cacheFrames = 0;
+  _cacheNext = 0;
+  _screen = nullptr;
+  _screenFields = 0;
+  _screenDrawn = false;
+  memset(_fieldText,0,sizeof(_fieldText));
+  memset(_fieldShown,0,sizeof(_fieldShown));
+  for (uint8_t ii=0;ii<OLED_STYLES+OLED_CUSTOMSTYLES;ii++) _layout[ii] = ii<OLED_STYLES ? &OLED_Layouts[ii] : nullptr;
+  _front = nullptr;
+  _presentPending = false;
+  _address = address;
+  for (uint8_t ii=0;ii<OLED_LANES;ii++) {
+    _head[ii] = 0;
+    _tail[ii] = 0;
+    _flushMark[ii] = 0;
+    _flushSeq[ii] = 0;
+    _flushSeen[ii] = 0;
+  }
+  _arenaHead = 0;
+  _arenaTail = 0;
+  _arenaRoom = 0;
+  memset(&_Stack,0,sizeof(_Stack));
+  _stackLane = 0;
+  _resume = 0;
+  _shadowValid = false;
+  memset(&_Flush,0,sizeof(_Flush));
+  _asyncFlush = false;
+  _flushBusy = false;
+  _flushBudget = OLED_FLUSHBUDGET;
+  _flushPage = 0;
+  _scrolling = false;
+  _pendingScroll = 0;
+  _fastText = true;
+  _scrollNext = false;
+  memset(&_Queue,0,sizeof(_Queue));
+  _liveClock = false;
+  _clockRow = false;
+  _dwellMin = OLED_DwellMin;
+  _dwellMax = OLED_DwellMax;
+  _shown = false;
+  _frameInterval = 1000/OLED_FrameRate;
+  _shownAt = 0;
+  _lastFrame = 0;
+  _marqueeAuto = false;
+  _marqueeStep = OLED_MarqueeStep;
+  _marqueeCount = 0;
+  for (uint8_t ii=0;ii<OLED_MARQUEES;ii++) _Marquee[ii].active = false;
+  #if OLED_MIRROR==1
+    _mirrorOut = nullptr;
+    _mirrorSink = nullptr;
+    _mirrorContext = nullptr;
+    _mirrorKey = true;
+    _mirrorFrameKey = false;
+    _mirrorOpen = false;
+    _mirrorSeq = 0;
+    _mirrorLen = 0;
+  #endif  //OLED_MIRROR
+  #if _STATSOLED==1
+    _statFlushTime = 0;
+    _frameRender = 0;
+    _frameFlush = 0;
+    _drawStyle = OLED_STYLES;
+    _frameStyle = OLED_STYLES;
+    ResetStatsOLED();
+  #endif  //_STATSOLED
+  _arbiter = _panelCount<OLED_PANELS;                     // join the bus arbiter, reported by begin if full
+  if ( _arbiter ) _Panels[_panelCount++] = this;
+}     // end of Init
+
+//****************************************************************************************/
+Oled_1306::~Oled_1306() {
+  /*
+   * Destructor: leave the bus arbiter, release the back buffer and the render cache
+   */
+  free(_spare);
+  free(_cache);
+  for (uint8_t ii=0;ii<_panelCount;ii++) {
+    if ( _Panels[ii]!=this ) continue;
+    _panelCount--;
+    for (uint8_t jj=ii;jj<_panelCount;jj++) _Panels[jj] = _Panels[jj+1];
+    _Panels[_panelCount] = nullptr;
+    if ( _panelNext>=_panelCount ) _panelNext = 0;
+    break;
+  }   // end of panel search
+}   // end of ~Oled_1306
 
 //****************************************************************************************/
 bool Oled_1306::begin(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDelay){
@@ -82,23 +242,10 @@ bool Oled_1306::begin(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDe
    * returns  1 - OK
    *          0 - Error in starting Oled
    */
-  static const char Mname[] PROGMEM = "Oled1306::begin:";
-  static const char E0[] PROGMEM = "ERROR setup: SSD1306 allocation failed\nERROR setup: Processing stops!";
-  static const char L0[] PROGMEM = "OLED active. SSD1306 allocation successful. Version";
-  
   if ( !_activate ) return 0;                 // the library not activated
   delay(OLEDSTARTDELAY);                      // stability delay
-  if(!OLED_display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {    // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
-    _RunUtil_Oled.InfoStamp(_SysClock,Mname,E0,1,1); 
-    return  false;                            // error starting OLED
-  } else {
-    #if _LOGGMEOLED==1
-      _RunUtil_Oled.InfoStamp(_SysClock,Mname,L0,1,0); Serial.print(getVersion()); 
-      Serial.print(F(" Test pattern=")); Serial.print(option); Serial.print(F(" -END\n"));
-    #endif //_LOGGMEOLED
-    delay(OLEDSTARTDELAY);                    // stability delay
-    OLED_display.clearDisplay();
-  }   // end of Oled initiaion
+  if ( !PanelBegin(_SysClock,option) ) return false;    // error starting OLED
+  delay(OLEDSTARTDELAY);                      // stability delay
 
   // init tests
   uint16_t  _useDelay=PostDisplayDelay;       // set delay by default or by parameter
@@ -117,12 +264,115 @@ bool Oled_1306::begin(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDe
       break;
   }   // end of test pattern
 
-  // init display
-  OLED_display.clearDisplay();                // Clear display buffer
+  PanelReady();                               // init display
+  return  true;
+}     // end of begin 
+
+//****************************************************************************************/
+bool Oled_1306::PanelBegin(TimePack _SysClock, uint8_t option) {
+  /*
+   * method to start the SSD1306 after the power up delay (begin, StartStepOLED)
+   * returns  1 - OK; 0 - Error in starting Oled
+   */
+  static const char Mname[] PROGMEM = "Oled1306::begin:";
+  static const char E0[] PROGMEM = "ERROR setup: SSD1306 allocation failed\nERROR setup: Processing stops!";
+  static const char L0[] PROGMEM = "OLED active. SSD1306 allocation successful. Version";
+  static const char E1[] PROGMEM = "ERROR setup: more panels than OLED_PANELS, this one is not served by ServiceAllOLED";
+  
+  if(!_display.begin(SSD1306_SWITCHCAPVCC, _address)) {    // SSD1306_SWITCHCAPVCC = generate display voltage from 3.3V internally
+    _RunUtil_Oled.InfoStamp(_SysClock,Mname,E0,1,1); 
+    return  false;                            // error starting OLED
+  }
+  if ( !_arbiter ) _RunUtil_Oled.InfoStamp(_SysClock,Mname,E1,1,1);   // FlushStatsOLED().arbiter
+  #if _LOGGMEOLED==1
+    _RunUtil_Oled.InfoStamp(_SysClock,Mname,L0,1,0); Serial.print(getVersion()); 
+    Serial.print(F(" Test pattern=")); Serial.print(option); Serial.print(F(" -END\n"));
+  #else
+    (void)option;
+  #endif //_LOGGMEOLED
+  if ( !OledPanelGeometry::adafruit ) {       // other panels (72x40): COM pins as the geometry
+    _display.ssd1306_command(SSD1306_SETCOMPINS);
+    _display.ssd1306_command(OledPanelGeometry::comPins);
+  }
+  ClearBuffer();
+  _shadowValid = false;                       // GDDRAM content after reset is unknown
+  return  true;
+}   // end of PanelBegin
+
+//****************************************************************************************/
+void Oled_1306::PanelReady() {
+  /*
+   * method to end the start up: clear and queue the initial message
+   */
+  ClearBuffer();                              // Clear display buffer
                                               // initial message: style-3 lines, no scroll, flush stack
   PushQueueOLED(6,4,1,M01,nullptr,M05,nullptr,M06,nullptr);
+}   // end of PanelReady
+
+//****************************************************************************************/
+bool Oled_1306::StartOLED(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDelay) {
+  /*
+   * method to initiate the display without blocking: as begin, but the power up delays, the test
+   * pattern steps and the post test delay are run by StartStepOLED (or TickOLED) from loop(), so
+   * the start up can go along with other set up (e.g. WiFi connect)
+   * <option>, <PostDisplayDelay> - as begin
+   * PopQueueDisplayOLED returns 4 (busy) until the start up is completed; records can be pushed
+   * returns  1 - start up begun; 0 - the library not activated
+   */
+  (void)_SysClock;
+  if ( !_activate ) return 0;                 // the library not activated
+  _startState = OLED_START_POWER;
+  _startOption = option;
+  _startStep = 0;
+  _startWait = OLEDSTARTDELAY;
+  _startPost = PostDisplayDelay==0 ? PostTestDelay : PostDisplayDelay;
+  _startAt = millis();
   return  true;
-}     // end of begin 
+}   // end of StartOLED
+
+//****************************************************************************************/
+uint8_t Oled_1306::StartStepOLED(TimePack _SysClock) {
+  /*
+   * method to run the start up of StartOLED, one step per call when due:
+   * power up delay, panel start, settle delay, one test pattern line / rectangle (flushed as a
+   * partial frame, only the columns it touched), post test delay, initial message
+   * returns  0 - display ready (start up completed or not requested)
+   *          1 - start up in progress
+   *          2 - the panel failed to start
+   */
+  if ( _startState==OLED_START_DONE ) return 0;
+  if ( _startState==OLED_START_FAIL ) return 2;
+  if ( ServiceOLED() ) return 1;              // step frame still being sent
+  if ( millis()-_startAt<_startWait ) return 1;
+  _startAt = millis();
+  switch ( _startState ) {
+    case  OLED_START_POWER:                   // power up delay over
+      if ( !PanelBegin(_SysClock,_startOption) ) {
+        _startState = OLED_START_FAIL;
+        return  2;
+      }
+      _startState = OLED_START_SETTLE;
+      _startWait = OLEDSTARTDELAY;
+      return  1;
+    case  OLED_START_SETTLE:                  // settle delay over
+      _startState = _startOption==1 || _startOption==2 ? OLED_START_PATTERN : OLED_START_POST;
+      _startWait = 0;
+      return  1;
+    case  OLED_START_PATTERN:                 // next pattern step
+      _startWait = PatternStep(_startOption,_startStep++);
+      if ( _startWait==0 ) {
+        _startState = OLED_START_POST;
+        _startWait = _startPost;                          // rectangles: post delay twice, as begin
+        if ( _startOption==2 ) _startWait += _startPost;
+      }
+      return  1;
+    case  OLED_START_POST:                    // post test delay over
+    default:
+      PanelReady();
+      _startState = OLED_START_DONE;
+      return  0;
+  }   // end of state
+}   // end of StartStepOLED
 
 //****************************************************************************************/
 uint8_t Oled_1306::PopQueueDisplayOLED(TimePack SysClock) {
@@ -130,18 +380,21 @@ uint8_t Oled_1306::PopQueueDisplayOLED(TimePack SysClock) {
    * method to pop a record from the queue stack and display on OLED @<style>
    * it returns indication about the current record content, so timing can be controlled
    * Theory of oprations
-   * for a recork in the stak; (1) pop (2) display (3) push back to implement scrolling
-   * in case of non empty stack, the scrolling is cancelled (otherwise, wirred order in the FIFO stack)
-   * <_Stack.scroll> sets the mechanism for scrolling: 3 is a still display before scroll, creating a push for 2 (scrolling) and
+   * for a recork in the stak; (1) pop (2) display (3) keep it as the next scroll step to implement scrolling
+   * in case of non empty stack, the scrolling is cancelled (the next record is popped instead)
+   * priority lanes: records of a higher lane are popped first; one arriving during a scroll sequence
+   * preempts it, and the interrupted record resumes at its scroll step when the higher lanes are done
+   * <_Stack.scroll> sets the mechanism for scrolling: 3 is a still display before scroll, keeping a step for 2 (scrolling) and
    * later 1. 4 means still display w/o scrolling
    * 
    * returns      0 - stack is empty
    *              1 - record found and diplayed
    *              2 - record found, displayed and scrolled
    *              3 - display cleared
+   *              4 - previous frame still being sent (async flush), nothing popped
    *
-   * if there is a record on stack queue, it check the scroll indicator: (push to complete the scroll action)
-   *  <scroll>    action                post action         push new record
+   * if there is a record on stack queue, it check the scroll indicator: (next step completes the scroll action)
+   *  <scroll>    action                post action         keep next step
    *    4         display freeze        -                   No
    *    3         display freeze        set <scroll> to 2   Yes
    *    2         display scroll left   set <scroll> to 1   Yes
@@ -168,98 +421,97 @@ uint8_t Oled_1306::PopQueueDisplayOLED(TimePack SysClock) {
    *  
    */
   if ( !_activate ) return 0;                               // the library not activated
+  if ( _startState!=OLED_START_DONE ) return 4;             // StartOLED in progress
+  if ( ServiceOLED() && (_spare==nullptr || _presentPending) ) return 4;   // previous frame still being sent
   TimePack _SysClock = SysClock;
-  OledStackDef _Stack;
                                                             // retrieve from stack
-  if (ShowOLED.isEmpty()) {                                 // queue is empty
-    _Stack.RC=0;
-    return  _Stack.RC; 
-  }   // end stack is empty
-  ShowOLED.pop(&_Stack);                                    // retieve (pop) data to be displayed
+  uint8_t source = NextSource();
+  if ( source==OLED_NEXT_EMPTY ) return 0;                   // queue is empty, nothing to scroll
+  if ( source>=OLED_NEXT_RESUME ) {                          // interrupted record resumes at its scroll step
+    _stackLane = source-OLED_NEXT_RESUME;
+    _Stack = _Resume[_stackLane];
+    _resume &= ~(1<<_stackLane);
+  } else if ( source!=OLED_NEXT_SCROLL ) {                   // new record cancels a scroll in progress
+    if ( _scrollNext && source>_stackLane ) {               // or preempts it: keep it to resume
+      _Resume[_stackLane] = _Stack;
+      _resume |= 1<<_stackLane;
+    }
+    PopQueue(source,&_Stack);
+    _stackLane = source;
+    _resume &= ~(1<<source);                                // a newer record of the lane supersedes
+  }   // end of source
+  ReleaseArena();                                           // payloads of the records done with
+  _scrollNext = false;
                                                             // display
-  switch ( _Stack.style ) {                                 // select style to display
-    case  0:                                                // default: top,middle,time
-      DisplayMemory(_SysClock,1,_Stack.payload0,_Stack.payload1);
-      break;
-    case  1:                                                // IP head, 2 lines IP, time
-      DisplayMix(_SysClock,3,M03,_Stack.payload1);
-      break;
-    case  2:                                                // top,2 middle, time
-      DisplayMemory(_SysClock,3,_Stack.payload0,_Stack.payload1);
-      break;
-    case  3:                                                // clear display
-      _Stack.scroll = 0;
-      break;
-    case  4:                                                // top,2 middle, bottom
-    case  6:                                                // top,2 middle, bottom
-      DisplayMemory(_SysClock,0,_Stack.payload0,_Stack.payload1,_Stack.payload2);
-      break;
-    case  5:                                                // top,2 middle, bottom
-    case  7:                                                // top,2 middle, bottom
-      DisplayMemory(_SysClock,2,_Stack.payload0,_Stack.payload1,_Stack.payload2);
-      break;
-    default:                                                // error
-      break;
-  }   // end of style switch
-                                                            // scrolling mechanism and push back
+  OledTextRun rows[3] = {RowRun(&_Stack,0),RowRun(&_Stack,1),RowRun(&_Stack,2)};  // lengths of push time
+  uint32_t  key = _cache==nullptr ? 0 : RenderKey(&_Stack); // scroll steps and repeats restore the frame
+  OLED_STAT( uint32_t statStart = micros(); )
+  OLED_STAT( uint32_t statFlush = _statFlushTime; )
+  OLED_STAT( _drawStyle = _Stack.style<OLED_STYLES ? _Stack.style : OLED_STYLES; )
+  const OledLayoutDef* layout = Layout(_Stack.style);     // style table, no layout - error
+  if ( layout!=nullptr && (layout->flags&OLED_LAYOUT_CLEAR) ) {
+    _Stack.scroll = 0;                                      // clear display
+  } else if ( layout!=nullptr ) {
+    if ( layout->header!=nullptr ) rows[0] = TextRunOLED(layout->header,true);
+    DisplayRows(_SysClock,layout,rows,key);
+  }   // end of style select
+                                                            // scrolling mechanism; the record is kept
+                                                            // for the next scroll step (no push back)
   switch ( _Stack.scroll ) {                                // select scroll mode
     case  4:                                                // display no scroll
-      OLED_display.stopscroll();
+      ScrollOLED(0);
       _Stack.RC = 1;
       break;
     case  3:                                                // still display before scroll
       _Stack.scroll--;
-      if ( ShowOLED.peek(&_Stack) ) {;                     // stack not empty!
-      } else {                                             // stack empty - can push to scroll
-        PushQueueOLED(_Stack.style,_Stack.scroll,0,nullptr,_Stack.payload0,nullptr,_Stack.payload1,nullptr,_Stack.payload2);
-      }
-      OLED_display.stopscroll();
+      _scrollNext = true;
+      ScrollOLED(0);
       _Stack.RC = 1;
       break;
     case  2:                                                // scroll left
       _Stack.scroll--;
-      OLED_display.startscrollleft  (0x00, 0x0F);
-      if ( ShowOLED.peek(&_Stack) ) {;                     // stack not empty!
-      } else {                                             // stack empty - can push to scroll
-        PushQueueOLED(_Stack.style,_Stack.scroll,0,nullptr,_Stack.payload0,nullptr,_Stack.payload1,nullptr,_Stack.payload2);
-      }
+      _scrollNext = true;
+      ScrollOLED(1);
       _Stack.RC = 2;
       break;
     case  1:                                                // scroll right
       _Stack.scroll--;
-      OLED_display.startscrollright (0x00, 0x0F);
-      if ( ShowOLED.peek(&_Stack) ) {;                     // stack not empty!
-      } else {                                             // stack empty - can push to scroll
-        PushQueueOLED(_Stack.style,_Stack.scroll,0,nullptr,_Stack.payload0,nullptr,_Stack.payload1,nullptr,_Stack.payload2);
-      }
+      _scrollNext = true;
+      ScrollOLED(2);
       _Stack.RC = 2;
       break;
     case  0:                                                // clear display
-      OLED_display.clearDisplay();
-      OLED_display.display();
+      ClearBuffer();
+      FlushOLED();
       _Stack.RC = 3;
       break;
     default:                                                // error
-      OLED_display.stopscroll();
+      ScrollOLED(0);
       _Stack.RC = 1;
       break;
   }   // end of scroll selection
+  #if _STATSOLED==1                                         // render time without the panel transfer
+    uint32_t  statRender = (micros()-statStart)-(_statFlushTime-statFlush);
+    _Stats.renderTime[_drawStyle] += statRender;
+    _Stats.renders[_drawStyle]++;
+    _frameRender = statRender;
+    _drawStyle = OLED_STYLES;
+  #endif  //_STATSOLED
 
   #if _DEBUGOLED==1
     Serial.print("ACK 00:00:00 PopQueueDisplayOLED style="); Serial.print(_Stack.style); Serial.print(" scroll="); Serial.print(_Stack.scroll); 
-    Serial.print(" Stack:["); Serial.print(_Stack.payload0); Serial.print("] ["); Serial.print(_Stack.payload1); 
-    Serial.print("] ["); Serial.print(_Stack.payload2); Serial.print("] RC="); Serial.print(_Stack.RC); Serial.print("-END\n");
+    Serial.print(" Stack:"); PrintRecord(&_Stack); Serial.print(" RC="); Serial.print(_Stack.RC); Serial.print("-END\n");
   #endif  //_DEBUGOLED
   return  _Stack.RC;
 }   // end of PopQueueDisplayOLED
 
 //****************************************************************************************/
-bool Oled_1306::PushQueueOLED(uint8_t style, uint8_t scroll, bool flush,
+bool OLED_ISR_ATTR Oled_1306::PushQueueOLED(uint8_t style, uint8_t scroll, bool flush,
                       const char* P0_pgm, char* P0_dyn, 
                       const char* P1_pgm, char* P1_dyn, 
-                      const char* P2_pgm, char* P2_dyn) {
+                      const char* P2_pgm, char* P2_dyn, uint8_t key, uint8_t lane) {
   /*
-   * method to push parameters into FIFO stack
+   * method to push parameters into the FIFO stack of <lane>
    *
    * style      - style {0,1,2,3,4,5,6,7}
    * scroll     - controls the scrolling of the display of this record {0,1,2,3,4}
@@ -267,67 +519,380 @@ bool Oled_1306::PushQueueOLED(uint8_t style, uint8_t scroll, bool flush,
    * P0_pgm / P0_dyn is payload to line 0
    * P1_pgm / P1_dyn is payload to line 1
    * P2_pgm / P2_dyn is payload to line 2
+   * key        - 0 - plain record; else a newer push with the same key replaces the queued record
+   * lane       - priority {0,...,<OLED_LANES>-1}; a record of a higher lane is displayed first and
+   *              preempts the record on display, which resumes afterwards (see PopQueueDisplayOLED)
    * each payload field get on of {Px_pgm,Px_dyn}, one of each of the pairs must exist
-   * returns  - 1 - for successful push
-   *            0 - for error or function in active
+   * PROG MEM payloads are referenced by pointer (not copied); regular memory payloads are copied
+   * into the payload arena (up to <PAYLOADMAXLEN> chars each, see PayloadQueueOLED)
+   * the record is built in place in the queue slot (ReserveQueueOLED/CommitQueueOLED); safe to call
+   * from a timer ISR as long as it is the only producer (of all lanes, they share the arena): the push
+   * methods are in IRAM (OLED_ISR_ATTR) and call no library functions. PROG MEM payloads are read for
+   * their length: from an ISR that may run while the flash cache is off pass regular memory payloads
+   * only (os_timer and Ticker callbacks run as tasks and may pass both)
+   * returns  - 1 - for successful push (queued or coalesced, see CommitQueueOLED)
+   *            0 - for error (queue full) or function in active
    */
-  static const char ArgumetError[] PROGMEM = "ERROR!";
-  static const char ArgumetTimestamp[] PROGMEM = "Timestamp";
   if ( !_activate ) return 0;                               // the library not activated
-  OledStackDef _Stack;
-  _Stack.RC = 0;
-  _Stack.scroll = scroll;
-  _Stack.style = style;
-  char* pntr;
-                                                            // select and load argument 0
-  if ( P0_dyn==nullptr ) {                                  // reg mem not provided
-    if ( P0_pgm==nullptr ) strcpy_P(_Stack.payload0,ArgumetError); // error - no arguments provided
-    else strcpy_P(_Stack.payload0,P0_pgm);                  // PROG MEM provided
-  } else {                                                  // regular mem provided
-    pntr = P0_dyn;
-    for ( uint8_t ii=0;ii<PAYLOADMAXLEN;ii++){
-      _Stack.payload0[ii] = 0x00;
-      if ( *pntr == 0x00 ) break;
-      _Stack.payload0[ii] = *pntr++;
-    } // end of copy loop
-  } // end of argument 0 selection
-
-                                                            // select and load argument 1
-  if ( P1_dyn==nullptr ) {                                  // reg mem not provided
-    if ( P1_pgm==nullptr ) strcpy_P(_Stack.payload1,ArgumetError);  // error - no arguments provided
-    else strcpy_P(_Stack.payload1,P1_pgm);                  // PROG MEM provided
-  } else {                                                  // regular mem provided
-    pntr = P1_dyn;
-    for ( uint8_t ii=0;ii<PAYLOADMAXLEN;ii++){
-      _Stack.payload1[ii] = 0x00;
-      if ( *pntr == 0x00 ) break;
-      _Stack.payload1[ii] = *pntr++;
-    } // end of copy loop
-  } // end of argument 1 selection
-
-                                                            // select and load argument 2
-  if (style==0 || style==1 || style==2 ) {                  // for third line time stamp - set on display time
-    strcpy_P(_Stack.payload2,ArgumetTimestamp);             // indicate timestamp
-  } else if ( P2_dyn==nullptr ) {                           // reg mem not provided
-    if ( P2_pgm==nullptr ) strcpy_P(_Stack.payload2,ArgumetError);  // error - no arguments provided
-    else strcpy_P(_Stack.payload2,P2_pgm);                  // PROG MEM provided
-  } else {                                                  // regular mem provided
-    pntr = P2_dyn;
-    for ( uint8_t ii=0;ii<PAYLOADMAXLEN;ii++){
-      _Stack.payload2[ii] = 0x00;
-      if ( *pntr == 0x00 ) break;
-      _Stack.payload2[ii] = *pntr++;
-    } // end of copy loop
+  if ( lane>=OLED_LANES ) lane = OLED_LANES-1;
+  OledStackDef* _Stack = ScratchSlot(lane);                 // fill the free slot at head in place
+  _Stack->RC = 0;
+  _Stack->scroll = scroll;
+  _Stack->style = style;
+  _Stack->key = key;
+  PayloadQueueOLED(_Stack,0,P0_pgm,P0_dyn);                 // select and load argument 0
+  PayloadQueueOLED(_Stack,1,P1_pgm,P1_dyn);                 // select and load argument 1
+  const OledLayoutDef* layout = Layout(style);
+  if ( layout!=nullptr && (layout->flags&OLED_LAYOUT_CLOCK) ) { // for third line time stamp - set on display time
+    _Stack->src[2] = OLED_SRC_CLOCK;
+    _Stack->pgm[2] = nullptr;
+  } else {
+    PayloadQueueOLED(_Stack,2,P2_pgm,P2_dyn);               // select and load argument 2
   } // end of argument 2 selection
-
                                                             // push into stack queue
-  if ( flush )  ShowOLED.flush();                           // reset (flash) the stack
-  if ( !ShowOLED.push(&_Stack) ) {                          // error on queue
-    return false;
-  }   
-  return  true; 
+  return  CommitQueueOLED(flush,lane);
 } // end of PushQueueOLED
 
+//****************************************************************************************/
+bool OLED_ISR_ATTR Oled_1306::PayloadQueueOLED(OledStackDef* slot, uint8_t row, const char* pgm, char* dyn) {
+  /*
+   * producer: method to load one payload into a slot of ReserveQueueOLED
+   * the length is measured here once for the renders of the record (see RowRun)
+   * PROG MEM payload is stored as a pointer; regular memory payload is appended to the slot's
+   * payloads in the arena as a length byte, the chars and 0x00, cut to <PAYLOADMAXLEN> chars
+   * and to the arena room left
+   * <row>      - {0,1,2}
+   * <pgm>      - PROG MEM payload, used when <dyn> is nullptr
+   * <dyn>      - regular memory payload
+   * returns  - 1 - payload loaded in full; 0 - cut or left empty (arena full)
+   */
+  static const char ArgumetError[] PROGMEM = "ERROR!";
+  if ( dyn==nullptr ) {                                     // reg mem not provided
+    slot->src[row] = OLED_SRC_PGM;
+    slot->pgm[row] = pgm==nullptr ? ArgumetError : pgm;     // error - no arguments provided
+    uint8_t length = 0;                                     // TextRunOLED, inline (strlen_P is not in IRAM)
+    while ( length<255 && pgm_read_byte(slot->pgm[row]+length)!=0x00 ) length++;
+    slot->len[row] = length;
+    return  true;
+  }
+  slot->pgm[row] = nullptr;
+  slot->len[row] = 0;
+  if ( slot->textLen+3>_arenaRoom ) {                       // no room left for length, a char and 0x00
+    slot->src[row] = OLED_SRC_NONE;
+    _Queue.truncated++;
+    return  false;
+  }
+  slot->src[row] = OLED_SRC_DYN;
+  uint16_t  limit = _arenaRoom-slot->textLen-2;
+  if ( limit>PAYLOADMAXLEN ) limit = PAYLOADMAXLEN;
+  char* dest = &_Arena[slot->textAt+slot->textLen+1];
+  uint8_t ii = 0;
+  while ( ii<limit && dyn[ii]!=0x00 ) {                     // copy loop
+    dest[ii] = dyn[ii];
+    ii++;
+  }
+  dest[ii] = 0x00;
+  dest[-1] = ii;                                            // length prefix
+  slot->len[row] = ii;
+  slot->textLen += ii+2;
+  if ( dyn[ii]==0x00 ) return true;
+  _Queue.truncated++;
+  return  false;
+}   // end of PayloadQueueOLED
+
+//****************************************************************************************/
+const char* OLED_ISR_ATTR Oled_1306::RowText(const OledStackDef* record, uint8_t row) {
+  /*
+   * method to return the text of a record row
+   * returns  - PROG MEM pointer for OLED_SRC_PGM, pointer into the arena for OLED_SRC_DYN
+   *            nullptr for OLED_SRC_NONE / OLED_SRC_CLOCK
+   */
+  switch ( record->src[row] ) {
+    case  OLED_SRC_PGM:
+      return  record->pgm[row];
+    case  OLED_SRC_DYN:
+      break;
+    default:
+      return  nullptr;
+  }   // end of source
+  const char* text = &_Arena[record->textAt];               // dynamic payloads are back to back
+  for (uint8_t ii=0;ii<row;ii++) {
+    if ( record->src[ii]==OLED_SRC_DYN ) text += record->len[ii]+2;     // length byte, chars, 0x00
+  }
+  return  text+1;
+}   // end of RowText
+
+//****************************************************************************************/
+OledTextRun Oled_1306::RowRun(const OledStackDef* record, uint8_t row) {
+  /*
+   * method to return a record row as a text run, with the length measured at push time
+   */
+  OledTextRun run;
+  run.text = RowText(record,row);
+  run.length = run.text==nullptr ? 0 : record->len[row];
+  run.pgm = record->src[row]==OLED_SRC_PGM;
+  return  run;
+}   // end of RowRun
+
+//****************************************************************************************/
+void Oled_1306::DisplayRows( TimePack _SysClock, const OledLayoutDef* layout, const OledTextRun* rows, uint32_t key) {
+  /*
+   * method to display 3 lines on OLED rows, each from PROG MEM or regular memory
+   * <layout>     - row geometry and time row (style table, OLED_Types or SetStyleOLED)
+   * <rows>       - text run per row 0..2 (empty - row left empty; ignored on a row the layout does not use)
+   * <key>        - render cache key of the rows (RenderKey), 0 - not cached
+   *                a cached frame is restored by a copy and only the time row is drawn; when the
+   *                result equals the panel content the flush is skipped
+   */
+  for (uint8_t ii=0;ii<3;ii++) {
+    if ( rows[ii].text!=nullptr && rows[ii].length>PAYLOADMAXLEN ) return;     // error
+  }
+  bool  clock = layout->flags&OLED_LAYOUT_CLOCK;          // time on the bottom row
+  
+  DrawReady();                                            // frame buffer is free to draw
+  if ( key!=0 && CacheLoad(key) ) {                       // same rows rendered before
+    if ( clock ) SetTimeToRow2(_SysClock);
+    #if OLED_PARTIALFLUSH==1
+      if ( _shadowValid && !_flushBusy && !_presentPending &&
+           memcmp(_display.getBuffer(),_shadow,SCREEN_BUFSIZE)==0 ) {
+        _Flush.flushSkips++;                              // the panel shows this frame already
+        return;
+      }
+    #endif  //OLED_PARTIALFLUSH
+    FlushOLED();
+    return;
+  }   // end of cached frame
+  ClearBuffer();                                          // Clear display buffer
+  _display.setTextColor(WHITE);
+  _display.setFont();                                 // return to dealt font
+  uint8_t marquees = _marqueeCount;
+  for (uint8_t ii=0;ii<3;ii++) {                          // rows of the layout, unused rows skipped
+    const OledRowDef &row = layout->row[ii];
+    if ( row.size!=0 ) DisplayRow(row.start,row.size,rows[ii],row.marquee);
+  }   // end of row loop
+  if ( key!=0 && _marqueeCount==marquees ) CacheStore(key);   // a marquee row is not a still frame
+  if ( clock ) SetTimeToRow2(_SysClock);                  // time row last, over the cached frame
+  FlushOLED();                                            // display
+}   // end of DisplayRows
+
+//****************************************************************************************/
+uint32_t Oled_1306::RenderKey(const OledStackDef* record) {
+  /*
+   * method to hash (FNV-1a) what a record draws besides the time row: style, marquee mode and the
+   * row texts (by content, PROG MEM ones as well)
+   * returns  the key, 0 - not cached (clear display or undefined style)
+   */
+  const OledLayoutDef* layout = Layout(record->style);
+  if ( layout==nullptr || (layout->flags&OLED_LAYOUT_CLEAR) ) return 0;
+  uint32_t  hash = 2166136261UL;
+  hash = (hash^record->style)*16777619UL;
+  hash = (hash^(_marqueeAuto ? 1 : 0))*16777619UL;
+  for (uint8_t row=0;row<3;row++) {
+    OledTextRun run = RowRun(record,row);
+    hash = (hash^run.length)*16777619UL;
+    if ( run.text==nullptr ) continue;
+    for (uint8_t ii=0;ii<run.length;ii++) {
+      uint8_t c = run.pgm ? pgm_read_byte(run.text+ii) : run.text[ii];
+      hash = (hash^c)*16777619UL;
+    }
+  }   // end of row loop
+  return  hash==0 ? 1 : hash;
+}   // end of RenderKey
+
+//****************************************************************************************/
+bool Oled_1306::CacheLoad(uint32_t key) {
+  /*
+   * method to copy the cached frame of <key> into the frame buffer
+   * the frame is replaced as by ClearBuffer: the live time row, the marquees and the retained screen are gone
+   * returns  1 - restored; 0 - not in the cache
+   */
+  for (uint8_t ii=0;ii<_cacheFrames;ii++) {
+    if ( _cacheKey[ii]!=key ) continue;
+    _clockRow = false;
+    _screenDrawn = false;
+    StopMarqueeOLED(0xFF);
+    memcpy(_display.getBuffer(),&_cache[ii*SCREEN_BUFSIZE],SCREEN_BUFSIZE);
+    _Flush.cacheHits++;
+    return  true;
+  }
+  return  false;
+}   // end of CacheLoad
+
+//****************************************************************************************/
+void Oled_1306::CacheStore(uint32_t key) {
+  /*
+   * method to keep the frame buffer as the cached frame of <key>, replacing the oldest frame
+   */
+  memcpy(&_cache[_cacheNext*SCREEN_BUFSIZE],_display.getBuffer(),SCREEN_BUFSIZE);
+  _cacheKey[_cacheNext] = key;
+  _cacheNext = (_cacheNext+1) % _cacheFrames;
+}   // end of CacheStore
+
+//****************************************************************************************/
+uint8_t Oled_1306::SetRenderCacheOLED(uint8_t frames) {
+  /*
+   * method to keep the last <frames> record frames {0 - off,...,<OLED_RENDERCACHE>} (RAM: SCREEN_BUFSIZE
+   * bytes each): a scroll step or a repeated record is then restored by a buffer copy instead of
+   * rendering its text again; the time row is always drawn fresh
+   * returns  frames allocated (0 - off or no memory)
+   */
+  if ( frames>OLED_RENDERCACHE ) frames = OLED_RENDERCACHE;
+  free(_cache);
+  _cache = frames==0 ? nullptr : (uint8_t*)malloc((size_t)frames*SCREEN_BUFSIZE);
+  _cacheFrames = _cache==nullptr ? 0 : frames;
+  _cacheNext = 0;
+  for (uint8_t ii=0;ii<OLED_RENDERCACHE;ii++) _cacheKey[ii] = 0;
+  return  _cacheFrames;
+}   // end of SetRenderCacheOLED
+
+//****************************************************************************************/
+bool Oled_1306::SetStyleOLED(uint8_t style, const OledLayoutDef* layout) {
+  /*
+   * method to set the layout of a style, without editing the library: a custom style
+   * {8,...,8+<OLED_CUSTOMSTYLES>-1} or a built in one {0,...,7} redefined
+   * <layout>   - constant table of the application (kept by pointer, PROG MEM <header> only),
+   *              e.g.  static const OledLayoutDef Big = {{OLED_ROW_0,OLED_ROW_1,OLED_ROW_NONE},
+   *                                                      nullptr,OLED_LAYOUT_CLOCK};
+   *              nullptr - built in layout (style {0,...,7}) or none (custom style)
+   * records of the style drawn with the new layout from the next pop; the render cache is dropped
+   * returns  1 - set; 0 - no such style
+   */
+  if ( style>=OLED_STYLES+OLED_CUSTOMSTYLES ) return false;
+  if ( layout==nullptr && style<OLED_STYLES ) layout = &OLED_Layouts[style];
+  _layout[style] = layout;
+  for (uint8_t ii=0;ii<OLED_RENDERCACHE;ii++) _cacheKey[ii] = 0;   // frames of the old layout
+  return  true;
+}   // end of SetStyleOLED
+
+//****************************************************************************************/
+bool Oled_1306::ScreenOLED(const OledFieldDef* fields, uint8_t count) {
+  /*
+   * method to set a retained screen: the fields are defined once and each is redrawn in place only
+   * when its text changed (RefreshScreenOLED), so only its columns are flushed; no record is queued
+   * <fields>   - field table of the application (kept by pointer), e.g.
+   *              static const OledFieldDef Dash[] = {{0,0,2,5,Label,nullptr},{64,0,2,5,nullptr,Temp},
+   *                                                  {0,32,2,10,nullptr,nullptr}};
+   *              nullptr - no screen
+   * <count>    - fields {1,...,<OLED_FIELDS>}
+   * the screen is drawn in full now; a record displayed later covers it, and it is drawn in full again
+   * by the next RefreshScreenOLED (TickOLED: once no record is on display)
+   * returns  1 - set; 0 - no screen or the library not activated
+   */
+  if ( !_activate ) return false;                         // the library not activated
+  _screen = count==0 ? nullptr : fields;
+  _screenFields = count>OLED_FIELDS ? OLED_FIELDS : count;
+  _screenDrawn = false;
+  if ( _screen==nullptr ) return false;
+  RefreshScreenOLED();
+  return  true;
+}   // end of ScreenOLED
+
+//****************************************************************************************/
+bool Oled_1306::SetFieldOLED(uint8_t field, const char* text) {
+  /*
+   * method to set the text of a field without a fixed or bound text, up to <OLED_FIELDLEN> chars
+   * drawn by the next RefreshScreenOLED (TickOLED), only when different from the text shown
+   * returns  1 - set; 0 - no such field
+   */
+  if ( field>=OLED_FIELDS ) return false;
+  uint8_t ii = 0;
+  while ( text!=nullptr && ii<OLED_FIELDLEN && text[ii]!=0x00 ) {     // copy loop, cut to the field
+    _fieldText[field][ii] = text[ii];
+    ii++;
+  }
+  _fieldText[field][ii] = 0x00;
+  return  true;
+}   // end of SetFieldOLED
+
+//****************************************************************************************/
+bool Oled_1306::SetFieldOLED(uint8_t field, int32_t value) {
+  /*
+   * method to set a field to a number (decimal), as SetFieldOLED(field,text)
+   */
+  char  buffer[12];
+  ltoa(value,buffer,10);
+  return  SetFieldOLED(field,buffer);
+}   // end of SetFieldOLED
+
+//****************************************************************************************/
+uint8_t Oled_1306::RefreshScreenOLED() {
+  /*
+   * method to redraw the fields of the retained screen whose text changed, and flush them
+   * after a record covered the screen, it is drawn in full
+   * returns  fields drawn, 0 - nothing changed or no screen
+   */
+  if ( !_activate || _screen==nullptr ) return 0;
+  uint8_t drawn = 0;
+  bool    full = !_screenDrawn;
+  if ( full ) ScrollOLED(0);                              // the screen replaces the frame
+  for (uint8_t ii=0;ii<_screenFields;ii++) {
+    if ( DrawField(ii,full) ) drawn++;
+  }   // end of field loop
+  _screenDrawn = true;
+  if ( drawn>0 ) FlushOLED();
+  return  drawn;
+}   // end of RefreshScreenOLED
+
+//****************************************************************************************/
+bool Oled_1306::DrawField(uint8_t field, bool always) {
+  /*
+   * method to draw a field of the retained screen when its text differs from the one drawn
+   * <always>   - draw the field (full redraw); the frame buffer is cleared with the first field
+   * returns  1 - drawn
+   */
+  const OledFieldDef &def = _screen[field];
+  char    text[OLED_FIELDLEN+1];
+  uint8_t width = def.width==0 || def.width>OLED_FIELDLEN ? OLED_FIELDLEN : def.width;
+  const char* source = def.pgm!=nullptr ? def.pgm : def.bound!=nullptr ? def.bound : _fieldText[field];
+  uint8_t length = 0;
+  bool    same = true;
+  while ( length<width ) {                                // copy loop, cut to the field
+    char  c = def.pgm!=nullptr ? (char)pgm_read_byte(source+length) : source[length];
+    if ( c==0x00 ) break;
+    same = same && _fieldShown[field][length]==c;
+    text[length++] = c;
+  }
+  text[length] = 0x00;
+  same = same && _fieldShown[field][length]==0x00;
+  if ( !always && same ) return false;                    // same text on the panel
+  memcpy(_fieldShown[field],text,length+1);
+  DrawReady();                                            // frame buffer is free to draw
+  if ( always && field==0 ) {
+    ClearBuffer();
+    OLED_STAT( _drawStyle = OLED_STYLES; )
+  }
+  _display.setTextColor(WHITE);
+  _display.setFont();
+  _display.setTextSize(def.size);
+  _display.fillRect(def.x,def.start,width*6*def.size,8*def.size,BLACK);
+  _display.setCursor(def.x,def.start);
+  if ( !BlitText(def.start,def.size,text,length,def.x) ) _display.print(text);
+  return  true;
+}   // end of DrawField
+
+//****************************************************************************************/
+const OledLayoutDef* OLED_ISR_ATTR Oled_1306::Layout(uint8_t style) {
+  /*
+   * method to return the layout of a style
+   * returns  the layout, nullptr - no such style
+   */
+  return  style<OLED_STYLES+OLED_CUSTOMSTYLES ? _layout[style] : nullptr;
+}   // end of Layout
+
+//****************************************************************************************/
+void Oled_1306::DisplayRow(uint8_t start, uint8_t size, const OledTextRun &run, bool marquee) {
+  /*
+   * method to display a row from PROG MEM or regular memory; an empty run leaves the row empty
+   * <marquee>  - the row is a single line: text wider than the screen runs as a marquee
+   *              (when enabled by SetMarqueeOLED) instead of wrapping
+   */
+  if ( run.text==nullptr || run.length==0 ) return;
+  if ( marquee && _marqueeAuto && run.length*6*size>SCREEN_WIDTH ) {
+    if ( StartMarquee(start,size,run) ) return;
+  }
+  DrawRun(start,size,run);
+}   // end of DisplayRow
+
 //****************************************************************************************/
 void Oled_1306::DisplayMemory( TimePack _SysClock, uint8_t type, char* row0_str, 
                             char* row1_str, char* row2_str) {
@@ -347,43 +912,8 @@ void Oled_1306::DisplayMemory( TimePack _SysClock, uint8_t type, char* row0_str,
    * <row1_str>   - pointer to data for row 1
    * <row2_str>   - pointer to data for row 2 (optional argument for type {1,3})
    */
-  uint8_t len0=0;
-  uint8_t len1=0;
-  uint8_t len2=0;
-  if ( row0_str!=nullptr ) len0 = strlen(row0_str);
-  if ( len0>PAYLOADMAXLEN ) return;                       // error
-  if ( row1_str!=nullptr )  len1 = strlen(row1_str);
-  if ( len1>PAYLOADMAXLEN ) return;                       // error
-  if ( row2_str!=nullptr )  len2 = strlen(row2_str);
-  if ( len2>PAYLOADMAXLEN ) return;                       // error
-  
-  OLED_display.clearDisplay();                            // Clear display buffer
-  OLED_display.setTextColor(WHITE);
-  OLED_display.setFont();                                 // return to dealt font
-  if ( len0>0 ) DisplayLine( OLED_Start_row_0,len0,OLED_CharSize_row_0,row0_str);
-
-  switch ( type ) {
-    case  0:                                              // 0 - 3 provided lines size 2,3,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_1,len1,OLED_CharSize_row_1,row1_str);
-      if ( len2>0 ) DisplayLine( OLED_Start_row_2,len2,OLED_CharSize_row_2,row2_str);
-      break;
-    case  1:                                              // 1 - 2 provided lines, line 3 is time, size 2,3,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_1,len1,OLED_CharSize_row_1,row1_str);
-      SetTimeToRow2(_SysClock);
-      break;
-    case  2:                                              // 0 - 3 provided lines size 2,2,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_3,len1,OLED_CharSize_row_3,row1_str);
-      if ( len2>0 ) DisplayLine( OLED_Start_row_2,len2,OLED_CharSize_row_2,row2_str);
-      break;
-    case  3:                                              // 1 - 2 provided lines, line 3 is time, size 2,2,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_3,len1,OLED_CharSize_row_3,row1_str);
-      SetTimeToRow2(_SysClock);
-      break;
-    case  4:
-    default:
-      break;
-  } // end of type 
-  OLED_display.display();                                 // display
+  OledTextRun rows[3] = {TextRunOLED(row0_str),TextRunOLED(row1_str),TextRunOLED(row2_str)};
+  DisplayRows(_SysClock,TypeLayout(type),rows);
 }   // end of DisplayMemory
 
 //****************************************************************************************/
@@ -402,40 +932,26 @@ void Oled_1306::DisplayMix( TimePack _SysClock, uint8_t type, const char* row0_c
    * <row0_cst>   - pointer to data for row 0 (prog mem)
    * <row1_str>   - pointer to data for row 1 (reg mem)
    */
-  uint8_t len0=0;
-  uint8_t len1=0;
+  OledTextRun row0 = TextRunOLED(row0_cst,true);
+  OledTextRun row1 = TextRunOLED(row1_str);
   #if _DEBUGOLED==1
   
   #endif  //_DEBUGOLED==1
-  if ( row0_cst!=nullptr ) len0 = strlen_P(row0_cst);
-  if ( len0>PAYLOADMAXLEN ) return;                       // error
-  if ( row1_str!=nullptr )  len1 = strlen(row1_str);
-  if ( len1>PAYLOADMAXLEN ) return;                       // error
+  if ( row0.length>PAYLOADMAXLEN ) return;                // error
+  if ( row1.length>PAYLOADMAXLEN ) return;                // error
   
-  OLED_display.clearDisplay();                            // Clear display buffer
-  OLED_display.setTextColor(WHITE);
-  OLED_display.setFont();                                 // return to dealt font
-  if ( len0>0 ) DisplayLine( OLED_Start_row_0,len0,OLED_CharSize_row_0,row0_cst);
-
-  switch ( type ) {                                       // select option for middle row
-    case  1:                                              // wide middle row
-      if ( len1>0 ) DisplayLine( OLED_Start_row_1,len1,OLED_CharSize_row_1,row1_str);
-      SetTimeToRow2(_SysClock);
-      break;
-    case  3:                                              // slim 2 middle rows
-      if ( len1>0 ) DisplayLine( OLED_Start_row_3,len1,OLED_CharSize_row_3,row1_str);
-      SetTimeToRow2(_SysClock);
-      break;
-
-    case  0:
-    case  2:
-    case  4:
-    default:
-      break;
-  } // end of type 
+  DrawReady();                                            // frame buffer is free to draw
+  ClearBuffer();                                          // Clear display buffer
+  _display.setTextColor(WHITE);
+  _display.setFont();                                 // return to dealt font
+  const OledLayoutDef* layout = TypeLayout(type);
+  const OledRowDef &top = layout->row[0];
+  const OledRowDef &middle = layout->row[1];
+  if ( row0.length>0 ) DrawRun( top.start,top.size,row0);
+  if ( (layout->flags&OLED_LAYOUT_CLOCK) && row1.length>0 ) DrawRun( middle.start,middle.size,row1);  // middle row of the time types
     
   SetTimeToRow2(_SysClock);                               // time to bottom row
-  OLED_display.display();                                 // display
+  FlushOLED();                                            // display
 }   // end of DisplayMix
 
 //****************************************************************************************/
@@ -445,107 +961,395 @@ void Oled_1306::DisplayLine( uint8_t start, uint8_t length, uint8_t size,
    * method to display a line on OLED with optional PROG MEM or regular memory
    */
   static const char ArgumetError[] PROGMEM = "ERROR";
-  char* pntr;
-  OLED_display.setTextSize(size);                           // value {1,...,8}
-  OLED_display.setCursor(0,start);                          // point to row start
-  if ( row_dyn==nullptr ) {                                 // reg mem not provided
-    char  buffer[PAYLOADMAXLEN];
-    pntr = &buffer[0];
-    if ( row_cst==nullptr ) {                               // error - no arguments provided
-      strcpy_P(buffer,ArgumetError);
-    } else {                                                // PROG MEM provided
-      strcpy_P(buffer,row_cst);
-    }
-  } else {                                                  // regular mem provided
-    pntr = row_dyn;
-  } // end of argument selection
-  for (uint8_t ii=0;ii<length;ii++) OLED_display.print(*pntr++); 
+  OledTextRun run;
+  run.text = row_dyn!=nullptr ? row_dyn : row_cst;
+  run.length = length;
+  run.pgm = row_dyn==nullptr;
+  if ( run.text==nullptr ) run = TextRunOLED(ArgumetError,true);  // error - no arguments provided
+  DrawRun(start,size,run);
 } // end of DisplayLine
 
+//****************************************************************************************/
+void Oled_1306::DrawRun(uint8_t start, uint8_t size, const OledTextRun &run) {
+  /*
+   * method to render a text run at row <start> with text <size>, without measuring it again
+   * PROG MEM text is copied in one block (up to <PAYLOADMAXLEN> chars); the page aligned blitter
+   * renders the whole run, else Adafruit_GFX draws it (Print::write, still char by char)
+   */
+  char  buffer[PAYLOADMAXLEN+1];
+  const char* text = run.text;
+  uint8_t length = run.length;
+  DrawReady();                                              // frame buffer is free to draw
+  _display.setTextSize(size);                           // value {1,...,8}
+  _display.setCursor(0,start);                          // point to row start
+  if ( run.pgm ) {                                          // PROG MEM provided
+    if ( length>PAYLOADMAXLEN ) length = PAYLOADMAXLEN;
+    memcpy_P(buffer,text,length);
+    buffer[length] = 0x00;
+    text = buffer;
+  } // end of argument selection
+  if ( BlitText(start,size,text,length) ) return;           // page aligned fast path
+  _display.write((const uint8_t*)text,length);
+}   // end of DrawRun
+
+//****************************************************************************************/
+OledTextRun Oled_1306::TextRunOLED(const char* text, bool pgm) {
+  /*
+   * method to measure a text once, for DrawRunOLED and the display methods
+   * <text>   - chars ending with 0x00, nullptr - empty run
+   * <pgm>    - <text> in PROG MEM
+   * returns  the run; the length is limited to 255
+   */
+  OledTextRun run;
+  size_t  length = 0;
+  if ( text!=nullptr ) length = pgm ? strlen_P(text) : strlen(text);
+  run.text = text;
+  run.length = length>255 ? 255 : length;
+  run.pgm = pgm;
+  return  run;
+}   // end of TextRunOLED
+
+//****************************************************************************************/
+void Oled_1306::DrawRunOLED(const OledTextRun &run, uint8_t row) {
+  /*
+   * method to display a measured text run on OLED row {0,1,2,3} (row 3 is row 1 half size font)
+   * as SetCharsToRow, with the length taken from the run; use show() to display
+   */
+  uint8_t start;
+  uint8_t size;
+  if ( run.text==nullptr || run.length>PAYLOADMAXLEN ) return;    // error
+  if ( !RowGeometry(row,start,size) ) return;             // error
+  _display.setTextColor(WHITE);
+  _display.setFont();                                 // return to dealt font
+  DrawRun(start,size,run);
+}   // end of DrawRunOLED
+
 //****************************************************************************************/
 void Oled_1306::SetTimeToRow2(TimePack _SysClock) {
   /*
    * method to set system time to last row (2)
+   * the time and millis() are kept, so in live clock mode ServiceOLED keeps the row ticking
    */
-  OLED_display.setTextColor(WHITE);
-  OLED_display.setFont();                                 // return to dealt font
-  OLED_display.setTextSize(OLED_CharSize_row_2);          // value {1,...,8}
-  OLED_display.setCursor(0,OLED_Start_row_2);             // point to row start
-  OLED_display.print(F("T "));
-  OLED_display.print(_SysClock.clockHour/10);
-  OLED_display.print(_SysClock.clockHour%10);
-  OLED_display.print(F(":"));
-  OLED_display.print(_SysClock.clockMin/10);
-  OLED_display.print(_SysClock.clockMin%10);
-  OLED_display.print(F(":"));
-  OLED_display.print(_SysClock.clockSec/10);
-  OLED_display.print(_SysClock.clockSec%10);
-    
+  DrawReady();                                            // frame buffer is free to draw
+  _display.setTextColor(WHITE);
+  _display.setFont();                                 // return to dealt font
+  FormatTime(_clockShown,_SysClock.clockHour,_SysClock.clockMin,_SysClock.clockSec);
+  _clockBase = (uint32_t)_SysClock.clockHour*3600 + _SysClock.clockMin*60 + _SysClock.clockSec;
+  _clockMillis = millis();
+  _clockDue = 1000;                                       // mS after <_clockMillis> of the next second
+  _clockRow = true;
+  _display.setTextSize(OLED_CharSize_row_2);          // value {1,...,8}
+  _display.setCursor(0,OLED_Start_row_2);             // point to row start
+  if ( BlitText(OLED_Start_row_2,OLED_CharSize_row_2,_clockShown,10) ) return;
+  _display.print(_clockShown);
 }   // end of SetTimeToRow2
 
 //****************************************************************************************/
-void Oled_1306::DrawLinePattern(uint16_t PostDelay) {
+void Oled_1306::FormatTime(char* buffer, uint8_t hour, uint8_t min, uint8_t sec) {
   /*
-   * method to draw test patern of lines
-   * <PostDelay>  - the post test delay [mS] before return
+   * method to format the time row "T hh:mm:ss" (<buffer> of 11 chars)
    */
-  int16_t i;
+  buffer[0] = 'T';
+  buffer[1] = ' ';
+  buffer[2] = '0'+hour/10;
+  buffer[3] = '0'+hour%10;
+  buffer[4] = ':';
+  buffer[5] = '0'+min/10;
+  buffer[6] = '0'+min%10;
+  buffer[7] = ':';
+  buffer[8] = '0'+sec/10;
+  buffer[9] = '0'+sec%10;
+  buffer[10] = 0x00;
+}   // end of FormatTime
 
-  OLED_display.clearDisplay();                            // Clear display buffer
+//****************************************************************************************/
+void Oled_1306::SetLiveClockOLED(bool live) {
+  /*
+   * method to select the live clock mode
+   * <live>     - 1 - ServiceOLED advances the time row (row 2) from millis(), redrawing and flushing
+   *                  only the changed digits, while the displayed record has a time row
+   *              0 - the time row changes only when a record is displayed (default)
+   */
+  _liveClock = live;
+}   // end of SetLiveClockOLED
 
-  for(i=0; i<OLED_display.width(); i+=4) {
-    OLED_display.drawLine(0, 0, i, OLED_display.height()-1, WHITE);
-    OLED_display.display();                               // Update screen with each newly-drawn line
-    delay(1);
+//****************************************************************************************/
+bool Oled_1306::TickClock() {
+  /*
+   * method to redraw the changed digits of the live time row
+   * rows 0 and 1 are not touched; the flush sends only the changed columns of pages 6-7
+   * returns  1 - frame buffer changed
+   */
+  if ( !_liveClock || !_clockRow || _scrolling || _flushBusy ) return false;
+  uint32_t  elapsed = millis()-_clockMillis;
+  if ( (int32_t)(elapsed-_clockDue)<0 ) return false;     // same second
+  _clockDue = (elapsed/1000+1)*1000;
+  uint32_t  now = (_clockBase + elapsed/1000) % 86400UL;
+  char      buffer[11];
+  FormatTime(buffer,now/3600,(now/60)%60,now%60);
+  if ( memcmp(buffer,_clockShown,10)==0 ) return false;   // same second
+  _display.setTextColor(WHITE);
+  _display.setFont();
+  _display.setTextSize(OLED_CharSize_row_2);
+  for (uint8_t ii=0;ii<10;ii++) {                         // redraw changed character cells
+    if ( buffer[ii]==_clockShown[ii] ) continue;
+    int16_t x = ii*6*OLED_CharSize_row_2;
+    _display.fillRect(x,OLED_Start_row_2,6*OLED_CharSize_row_2,8*OLED_CharSize_row_2,BLACK);
+    _display.setCursor(x,OLED_Start_row_2);
+    if ( !BlitText(OLED_Start_row_2,OLED_CharSize_row_2,&buffer[ii],1,x) ) _display.print(buffer[ii]);
+    _clockShown[ii] = buffer[ii];
+  }   // end of cell loop
+  return  true;
+}   // end of TickClock
+
+//****************************************************************************************/
+uint8_t Oled_1306::TickOLED(TimePack _SysClock, uint32_t now) {
+  /*
+   * method to run the display from a single call in loop(), with <now> = millis()
+   * the next record (or scroll step) is displayed only when the record on display has been shown for
+   * its <dwellMin> and the frame rate limit allows; the last record is cleared after its <dwellMax>
+   * when nothing follows. A record of a higher lane is displayed without waiting for <dwellMin>; the
+   * record it cuts short is shown again when the higher lanes are done. Pending transfers and the live clock are serviced on every call.
+   * With no record on display the retained screen (ScreenOLED) is refreshed, changed fields only.
+   * returns      0 - nothing due / nothing displayed / retained screen refreshed
+   *              1,2,3 - as PopQueueDisplayOLED
+   *              4 - previous frame still being sent
+   */
+  if ( !_activate ) return 0;                               // the library not activated
+  if ( _startState!=OLED_START_DONE ) return StartStepOLED(_SysClock)==1 ? 4 : 0;  // StartOLED in progress
+  if ( _flushBusy || _liveClock || _marqueeCount>0 ) {      // transfer in progress, live time row, marquees
+    if ( ServiceOLED() ) return 4;
   }
-  for(i=0; i<OLED_display.height(); i+=4) {
-    OLED_display.drawLine(0, 0, OLED_display.width()-1, i, WHITE);
-    OLED_display.display();
-    delay(1);
+  uint8_t source = NextSource();
+  bool  next = source!=OLED_NEXT_EMPTY;
+  if ( !next && !_shown ) {                                 // idle: the retained screen, at the frame rate
+    if ( _screen!=nullptr && (int32_t)(now-(_lastFrame+_frameInterval))>=0 && RefreshScreenOLED()>0 ) _lastFrame = now;
+    return  0;
   }
-  delay(250);
+  uint32_t  due = _lastFrame+_frameInterval;                // frame rate limit
+  bool  preempt = source<OLED_LANES && source>_stackLane;   // higher lane: no dwell wait
+  if ( _shown && !preempt && (int32_t)(_shownAt+_Stack.dwellMin*100UL-due)>0 ) due = _shownAt+_Stack.dwellMin*100UL;
+  if ( next ) {                                             // next record or scroll step
+    if ( (int32_t)(now-due)<0 ) return 0;                   // not due yet
+    if ( preempt && _shown && !_scrollNext && (int32_t)(now-(_shownAt+_Stack.dwellMin*100UL))<0 ) {
+      _Resume[_stackLane] = _Stack;                         // cut short: shown again after the higher lane
+      _resume |= 1<<_stackLane;
+    }
+    uint8_t rc = PopQueueDisplayOLED(_SysClock);
+    if ( rc==0 || rc==4 ) return rc;
+    _shown = rc!=3;
+    _shownAt = now;
+    _lastFrame = now;
+    return  rc;
+  }   // end of next
+  if ( _Stack.dwellMax==0 ) return 0;                       // shown until replaced
+  if ( (int32_t)(now-(_shownAt+_Stack.dwellMax*100UL))<0 || (int32_t)(now-due)<0 ) return 0;
+  ScrollOLED(0);                                            // max dwell expired
+  clear();
+  _shown = false;
+  _lastFrame = now;
+  return  3;
+}   // end of TickOLED
 
-  OLED_display.clearDisplay();
+//****************************************************************************************/
+void Oled_1306::SetDwellOLED(uint8_t dwellMin, uint8_t dwellMax) {
+  /*
+   * method to set the dwell times of the records pushed from now on (TickOLED)
+   * <dwellMin>   - min display time of the record and of each scroll step [100mS]
+   * <dwellMax>   - max display time when no record follows [100mS], 0 - until replaced
+   */
+  _dwellMin = dwellMin;
+  _dwellMax = dwellMax;
+}   // end of SetDwellOLED
 
-  for(i=0; i<OLED_display.width(); i+=4) {
-    OLED_display.drawLine(0, OLED_display.height()-1, i, 0, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
-  for(i=OLED_display.height()-1; i>=0; i-=4) {
-    OLED_display.drawLine(0, OLED_display.height()-1, OLED_display.width()-1, i, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
-  delay(250);
+//****************************************************************************************/
+void Oled_1306::SetFrameRateOLED(uint8_t fps) {
+  /*
+   * method to limit the rate of frames rendered by TickOLED <fps> frames per second {1..100}
+   */
+  if ( fps==0 ) fps = 1;
+  _frameInterval = 1000/fps;
+}   // end of SetFrameRateOLED
 
-  OLED_display.clearDisplay();
+//****************************************************************************************/
+bool Oled_1306::RowGeometry(uint8_t row, uint8_t &start, uint8_t &size) {
+  /*
+   * method to get the start line and text size of row {0,1,2,3} (row 3 is row 1 half size font)
+   * returns  0 - no such row
+   */
+  if ( row>3 ) return false;                              // error
+  start = OLED_Rows[row].start;
+  size = OLED_Rows[row].size;
+  return  true;
+}   // end of RowGeometry
 
-  for(i=OLED_display.width()-1; i>=0; i-=4) {
-    OLED_display.drawLine(OLED_display.width()-1, OLED_display.height()-1, i, 0, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
-  for(i=OLED_display.height()-1; i>=0; i-=4) {
-    OLED_display.drawLine(OLED_display.width()-1, OLED_display.height()-1, 0, i, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
-  delay(250);
+//****************************************************************************************/
+bool Oled_1306::MarqueeOLED(uint8_t row, const char* pgm, char* dyn) {
+  /*
+   * method to run a text as a marquee on row {0,1,2,3}: the row's pages are shifted one column
+   * per step (SetMarqueeOLED) by ServiceOLED/TickOLED and only those pages are flushed
+   * <pgm> / <dyn> - PROG MEM or regular memory text, up to <OLEDMARQUEELEN>-1 chars
+   * the marquee stops when the frame buffer is cleared (next record) or by StopMarqueeOLED
+   * returns  1 - marquee started
+   *          0 - no such row, no free marquee slot or fast text not compiled in
+   */
+  uint8_t start;
+  uint8_t size;
+  if ( !_activate || !RowGeometry(row,start,size) ) return false;
+  DrawReady();                                            // frame buffer is free to draw
+  if ( !StartMarquee(start,size,dyn==nullptr ? TextRunOLED(pgm,true) : TextRunOLED(dyn)) ) return false;
+  FlushOLED();
+  return  true;
+}   // end of MarqueeOLED
 
-  OLED_display.clearDisplay();
+//****************************************************************************************/
+void Oled_1306::StopMarqueeOLED(uint8_t row) {
+  /*
+   * method to stop the marquee of row {0,1,2,3}; 0xFF - all rows. The row content stays as is
+   */
+  uint8_t start = 0xFF;
+  uint8_t size;
+  if ( row!=0xFF && !RowGeometry(row,start,size) ) return;
+  for (uint8_t ii=0;ii<OLED_MARQUEES;ii++) {
+    if ( !_Marquee[ii].active ) continue;
+    if ( row!=0xFF && _Marquee[ii].start!=start ) continue;
+    _Marquee[ii].active = false;
+    _marqueeCount--;
+  }   // end of slot loop
+}   // end of StopMarqueeOLED
 
-  for(i=0; i<OLED_display.height(); i+=4) {
-    OLED_display.drawLine(OLED_display.width()-1, 0, 0, i, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
-  for(i=0; i<OLED_display.width(); i+=4) {
-    OLED_display.drawLine(OLED_display.width()-1, 0, i, OLED_display.height()-1, WHITE);
-    OLED_display.display();
-    delay(1);
-  }
+//****************************************************************************************/
+void Oled_1306::SetMarqueeOLED(bool autoLong, uint16_t stepTime) {
+  /*
+   * method to set up the marquees
+   * <autoLong>   - 1 - queued payloads wider than the screen on rows 0,1,2 run as a marquee instead of wrapping
+   * <stepTime>   - mS per one column shift, 0 - keep
+   */
+  _marqueeAuto = autoLong;
+  if ( stepTime>0 ) _marqueeStep = stepTime;
+}   // end of SetMarqueeOLED
+
+//****************************************************************************************/
+bool Oled_1306::StartMarquee(uint8_t start, uint8_t size, const OledTextRun &run) {
+  /*
+   * method to start a marquee on the row at <start> and draw its first screen width
+   * the text is copied; a marquee already on the same row is replaced
+   */
+  #if OLED_FASTTEXT==1
+    uint8_t*  buffer = _display.getBuffer();
+    if ( buffer==nullptr || (start&0x07)!=0 || size<1 || size>3 ) return false;
+    OledMarqueeDef* marquee = nullptr;
+    for (uint8_t ii=0;ii<OLED_MARQUEES;ii++) {            // same row, else a free slot
+      if ( _Marquee[ii].active && _Marquee[ii].start==start ) {
+        marquee = &_Marquee[ii];
+        break;
+      }
+      if ( !_Marquee[ii].active && marquee==nullptr ) marquee = &_Marquee[ii];
+    }   // end of slot search
+    if ( marquee==nullptr ) return false;
+    uint8_t length = run.length<OLEDMARQUEELEN-1 ? run.length : OLEDMARQUEELEN-1;
+    if ( run.pgm ) memcpy_P(marquee->text,run.text,length);
+    else memcpy(marquee->text,run.text,length);
+    marquee->text[length] = 0x00;
+    marquee->length = length;
+    marquee->start = start;
+    marquee->size = size;
+    marquee->pos = 0;
+    marquee->last = millis();
+    if ( !marquee->active ) _marqueeCount++;
+    marquee->active = true;
+    for (uint8_t x=0;x<SCREEN_WIDTH;x++) MarqueeColumn(marquee,x,x);
+    return  true;
+  #else
+    (void)start; (void)size; (void)run;
+    return  false;
+  #endif  //OLED_FASTTEXT
+}   // end of StartMarquee
 
+//****************************************************************************************/
+bool Oled_1306::StepMarquee() {
+  /*
+   * method to advance the due marquees: the row pages are moved left by the elapsed steps
+   * (memmove in the page buffer) and the new columns are rendered at the right edge
+   * returns  1 - frame buffer changed
+   */
+  if ( _marqueeCount==0 || _scrolling ) return false;
+  uint8_t*  buffer = _display.getBuffer();
+  uint32_t  now = millis();
+  bool      changed = false;
+  for (uint8_t ii=0;ii<OLED_MARQUEES;ii++) {
+    OledMarqueeDef* marquee = &_Marquee[ii];
+    if ( !marquee->active ) continue;
+    uint32_t  steps = (now-marquee->last)/_marqueeStep;
+    if ( steps==0 ) continue;
+    marquee->last += steps*_marqueeStep;
+    uint16_t  strip = (marquee->length+OLED_MarqueeGap)*6*marquee->size;
+    if ( steps>SCREEN_WIDTH ) steps = SCREEN_WIDTH;
+    marquee->pos = (marquee->pos+steps) % strip;
+    for (uint8_t sp=0;sp<marquee->size;sp++) {            // shift the row pages
+      uint8_t page = (marquee->start>>3)+sp;
+      if ( page>=SCREEN_PAGES ) break;
+      memmove(&buffer[page*SCREEN_WIDTH],&buffer[page*SCREEN_WIDTH+steps],SCREEN_WIDTH-steps);
+    }
+    for (uint8_t x=SCREEN_WIDTH-steps;x<SCREEN_WIDTH;x++) MarqueeColumn(marquee,x,(marquee->pos+x) % strip);
+    changed = true;
+  }   // end of marquee loop
+  return  changed;
+}   // end of StepMarquee
+
+//****************************************************************************************/
+void Oled_1306::MarqueeColumn(const OledMarqueeDef* marquee, uint8_t x, uint16_t column) {
+  /*
+   * method to render column <column> of the marquee text strip (text followed by a gap) at screen column <x>
+   */
+  #if OLED_FASTTEXT==1
+    uint8_t*  buffer = _display.getBuffer();
+    uint16_t  cell = 6*marquee->size;
+    uint16_t  index = column/cell;
+    uint8_t   col = (column%cell)/marquee->size;
+    uint32_t  bits = 0;
+    if ( index<marquee->length && col<5 ) {               // glyph column, else gap or blank column
+      uint8_t c = marquee->text[index];
+      if ( c>=176 ) c++;                                  // GFX classic font index (cp437 off)
+      bits = ScaleColumn(pgm_read_byte(&font[c*5+col]),marquee->size);
+    }
+    for (uint8_t sp=0;sp<marquee->size;sp++) {
+      uint8_t page = (marquee->start>>3)+sp;
+      if ( page>=SCREEN_PAGES ) break;
+      buffer[page*SCREEN_WIDTH+x] = (uint8_t)bits;
+      bits >>= 8;
+    }
+  #else
+    (void)marquee; (void)x; (void)column;
+  #endif  //OLED_FASTTEXT
+}   // end of MarqueeColumn
+
+//****************************************************************************************/
+void Oled_1306::ClearBuffer() {
+  /*
+   * method to clear the frame buffer; the live time row, the marquees and the retained screen are gone with it
+   */
+  _display.clearDisplay();
+  _clockRow = false;
+  _screenDrawn = false;
+  StopMarqueeOLED(0xFF);
+}   // end of ClearBuffer
+
+//****************************************************************************************/
+void Oled_1306::DrawLinePattern(uint16_t PostDelay) {
+  /*
+   * method to draw test patern of lines
+   * <PostDelay>  - the post test delay [mS] before return
+   */
+  bool    async = _asyncFlush;                              // patterns draw between flushes - block
+  _asyncFlush = false;
+  FinishFlush();
+  for (uint16_t step=0;;step++) {
+    uint16_t  wait = PatternStep(1,step);                   // Update screen with each newly-drawn line
+    if ( wait==0 ) break;
+    delay(wait);
+  }
+  _asyncFlush = async;
   delay(PostDelay);                                         // Pause for <PostDelay> mS
 }     // end of DrawLinePattern
 
@@ -555,24 +1359,69 @@ void Oled_1306::DrawRecPattern(uint16_t PostDelay) {
    * method to draw test patern of rectangulars
    * <PostDelay>  - the post test delay [mS] before return
    */
-  int16_t i;
-  OLED_display.clearDisplay();                            // Clear display buffer
-  for(int16_t i=0; i<OLED_display.height()/2; i+=2) {
-    OLED_display.drawRect(i, i, OLED_display.width()-2*i, OLED_display.height()-2*i, WHITE);
-    OLED_display.display();                               // Update screen with each newly-drawn rectangle
-    delay(20);
+  bool    async = _asyncFlush;                            // patterns draw between flushes - block
+  _asyncFlush = false;
+  FinishFlush();
+  for (uint16_t step=0;;step++) {
+    uint16_t  wait = PatternStep(2,step);                 // Update screen with each newly-drawn rectangle
+    if ( wait==0 ) break;
+    delay(wait);
   }
+  _asyncFlush = async;
   delay(PostDelay);                                       // Pause for <PostDelay> mS
 }     // end of DrawRecPattern
 
+//****************************************************************************************/
+uint16_t Oled_1306::PatternStep(uint8_t option, uint16_t step) {
+  /*
+   * method to draw and flush step <step> of a test pattern (DrawLinePattern, DrawRecPattern, StartStepOLED)
+   * <option>   - 1 - lines: 8 fans of lines 4 pixels apart, the buffer cleared after each 2 fans
+   *              2 - rectangles 2 pixels apart
+   * returns  the pause [mS] after the step, 0 - pattern completed (nothing drawn)
+   */
+  int16_t w = _display.width();
+  int16_t h = _display.height();
+  DrawReady();                                            // frame buffer is free to draw
+  if ( step==0 ) ClearBuffer();                           // Clear display buffer
+  if ( option==2 ) {                                      // rectangles
+    int16_t i = step*2;
+    if ( i>=h/2 ) return 0;
+    _display.drawRect(i, i, w-2*i, h-2*i, WHITE);
+    FlushOLED();
+    return  20;
+  }
+  uint16_t  nw = (w+3)/4;                                 // lines per fan across the width / height
+  uint16_t  nh = (h+3)/4;
+  const uint16_t  fan[8] = {nw,nh,nw,nh,nw,nh,nh,nw};
+  uint8_t s = 0;
+  while ( s<8 && step>=fan[s] ) step -= fan[s++];
+  if ( s>=8 ) return 0;
+  int16_t k = step*4;
+  if ( step==0 && (s==2 || s==4 || s==6) ) ClearBuffer();
+  switch ( s ) {
+    case  0:  _display.drawLine(0, 0, k, h-1, WHITE);          break;
+    case  1:  _display.drawLine(0, 0, w-1, k, WHITE);          break;
+    case  2:  _display.drawLine(0, h-1, k, 0, WHITE);          break;
+    case  3:  _display.drawLine(0, h-1, w-1, h-1-k, WHITE);    break;
+    case  4:  _display.drawLine(w-1, h-1, w-1-k, 0, WHITE);    break;
+    case  5:  _display.drawLine(w-1, h-1, 0, h-1-k, WHITE);    break;
+    case  6:  _display.drawLine(w-1, 0, 0, k, WHITE);          break;
+    default:  _display.drawLine(w-1, 0, k, h-1, WHITE);        break;
+  }   // end of fan
+  FlushOLED();
+  if ( step==fan[s]-1 && (s==1 || s==3 || s==5) ) return 1+250;    // pause between fan pairs
+  return  1;
+}   // end of PatternStep
+
 //****************************************************************************************/
 void Oled_1306::clear() {
   /*
    * method to clear OLED 
    */
   if ( !_activate ) return;                               // the library not activated
-  OLED_display.clearDisplay();                            // Clear display buffer
-  OLED_display.display();                                 // display
+  DrawReady();                                            // frame buffer is free to draw
+  ClearBuffer();                                          // Clear display buffer
+  FlushOLED();                                            // display
 }     // end of show
 
 //****************************************************************************************/
@@ -581,18 +1430,299 @@ void Oled_1306::show() {
    * method to display OLED post printing
    */
   if ( !_activate ) return;                               // the library not activated
-  OLED_display.display();                                 // display
+  FlushOLED();                                            // display
 }     // end of show
 
+//****************************************************************************************/
+OledStackDef* OLED_ISR_ATTR Oled_1306::ReserveQueueOLED(uint8_t lane) {
+  /*
+   * producer: method to get the next free queue slot, to be filled in place and published by CommitQueueOLED
+   * <key> is preset to 0, the dwell times to the SetDwellOLED values and the slot has no payloads;
+   * payloads are loaded with PayloadQueueOLED
+   * <lane>   - priority lane, to be committed with the same lane
+   * returns  - pointer to the slot
+   *            nullptr when the queue is full
+   */
+  if ( lane>=OLED_LANES ) lane = OLED_LANES-1;
+  if ( OLED_NEXT(_head[lane],lane)==_tail[lane] ) return nullptr;   // full
+  return  ScratchSlot(lane);
+}   // end of ReserveQueueOLED
+
+//****************************************************************************************/
+OledStackDef* OLED_ISR_ATTR Oled_1306::ScratchSlot(uint8_t lane) {
+  /*
+   * producer: method to prepare the slot at head of <lane> (free even when the lane is full)
+   * the slot gets the largest contiguous free part of the arena: the free bytes to the arena end,
+   * unless too short for a full payload and the free bytes at its start are more
+   */
+  OledStackDef* slot = &_Ring[OLED_LANEBASE(lane)+_head[lane]];
+  uint16_t  arenaHead = _arenaHead;
+  uint16_t  arenaTail = _arenaTail;
+  if ( arenaHead>=arenaTail ) {                             // free to the end and before the tail
+    _arenaRoom = OLED_ARENALEN-arenaHead-(arenaTail==0 ? 1 : 0);
+    if ( _arenaRoom<PAYLOADMAXLEN+2 && arenaTail>_arenaRoom+1 ) {    // wrap to the arena start
+      arenaHead = 0;
+      _arenaRoom = arenaTail-1;
+    }
+  } else {
+    _arenaRoom = arenaTail-arenaHead-1;
+  }   // end of arena room
+  if ( _arenaRoom>255 ) _arenaRoom = 255;                   // <textLen> range
+  slot->textAt = arenaHead;
+  slot->textLen = 0;
+  for (uint8_t ii=0;ii<3;ii++) {
+    slot->src[ii] = OLED_SRC_NONE;
+    slot->pgm[ii] = nullptr;
+    slot->len[ii] = 0;
+  }
+  slot->key = 0;                                            // defaults for the fields callers may skip
+  slot->dwellMin = _dwellMin;
+  slot->dwellMax = _dwellMax;
+  return  slot;
+}   // end of ScratchSlot
+
+//****************************************************************************************/
+bool OLED_ISR_ATTR Oled_1306::CommitQueueOLED(bool flush, uint8_t lane) {
+  /*
+   * producer: method to publish the slot filled after ReserveQueueOLED
+   * unless <flush> is set, the record is first coalesced with the pending ones:
+   *  - identical to the last queued record: dropped (the display shows the same)
+   *  - <key> not 0 and a queued record has the same key: that record is replaced in place
+   * the oldest record is never replaced, it may be being popped by the consumer; while a flush request
+   * is pending, only the records from its mark on are coalesced with (the ones before are dropped)
+   * <flush>    - if set, the entries before this one are dropped (done by the consumer on its next access)
+   *              only the entries of the same lane are dropped; a full lane takes the record in place
+   *              of its newest entry
+   * <lane>     - priority lane of ReserveQueueOLED
+   * returns  - 1 - record queued or coalesced
+   *            0 - queue full, record dropped (not with <flush>)
+   */
+  if ( lane>=OLED_LANES ) lane = OLED_LANES-1;
+  OledStackDef* ring = &_Ring[OLED_LANEBASE(lane)];
+  uint8_t head = _head[lane];
+  uint8_t tail = _tail[lane];
+  OledStackDef* record = &ring[head];                       // slot at head is free even when full
+  uint16_t  textEnd = record->textAt+record->textLen;
+  if ( textEnd>=OLED_ARENALEN ) textEnd = 0;                // filled to the arena end
+  uint8_t first = tail;                                     // first record kept by the consumer
+  if ( _flushSeq[lane]!=_flushSeen[lane] ) first = _flushMark[lane];  // flush pending
+  if ( !flush && first!=head ) {                            // coalesce with pending records
+    uint8_t last = head==0 ? OLED_LANELEN(lane) : head-1;
+    if ( SameRecord(&ring[last],record) ) {                 // repeated record
+      _Queue.coalesced++;
+      return  true;
+    }
+    if ( record->key!=0 ) {                                 // last writer wins for this key
+      if ( first==tail ) first = OLED_NEXT(tail,lane);      // not the oldest
+      for (uint8_t ii=first;ii!=head;ii=OLED_NEXT(ii,lane)) {
+        if ( ring[ii].key!=record->key ) continue;
+        CopyRecord(&ring[ii],record);                       // the older payloads are released with it
+        OLED_BARRIER();
+        _arenaHead = textEnd;
+        _Queue.coalesced++;
+        return  true;
+      }   // end of key search
+    }   // end of keyed record
+  }   // end of coalescing
+  if ( OLED_NEXT(head,lane)==tail ) {                       // full
+    if ( !flush ) {
+      _Queue.dropped++;
+      return  false;
+    }
+    uint8_t last = head==0 ? OLED_LANELEN(lane) : head-1;   // flush: the record takes the last slot, the
+    CopyRecord(&ring[last],record);                         // entries before it are dropped (<last> is not
+    _flushMark[lane] = last;                                // the tail, a lane holds 2 records at least)
+    OLED_BARRIER();
+    _arenaHead = textEnd;
+    _flushSeq[lane]++;
+    _Queue.pushed++;
+    return  true;
+  }
+  if ( flush ) {
+    _flushMark[lane] = head;
+    OLED_BARRIER();
+    _flushSeq[lane]++;
+  }
+  OLED_BARRIER();                                           // slot written before it is published
+  _head[lane] = OLED_NEXT(head,lane);
+  OLED_BARRIER();                                           // and published before its payloads (ReleaseArena)
+  _arenaHead = textEnd;
+  _Queue.pushed++;
+  OLED_STAT( uint8_t depth = OLED_NEXT(head,lane)>=tail ? OLED_NEXT(head,lane)-tail : OLED_NEXT(head,lane)+OLED_LANELEN(lane)+1-tail; )
+  OLED_STAT( if ( depth>_Stats.queueHigh ) _Stats.queueHigh = depth; )
+  return  true;
+}   // end of CommitQueueOLED
+
+//****************************************************************************************/
+bool OLED_ISR_ATTR Oled_1306::SameRecord(const OledStackDef* a, const OledStackDef* b) {
+  /*
+   * producer: method to compare the displayed content of two records (style, scroll, key and payloads)
+   */
+  if ( a->style!=b->style || a->scroll!=b->scroll || a->key!=b->key ) return false;
+  for (uint8_t ii=0;ii<3;ii++) {
+    if ( a->src[ii]!=b->src[ii] || a->len[ii]!=b->len[ii] ) return false;
+    if ( a->src[ii]==OLED_SRC_PGM && a->pgm[ii]!=b->pgm[ii] ) return false;
+    if ( a->src[ii]!=OLED_SRC_DYN ) continue;
+    const char* textA = RowText(a,ii);                      // same length, compare the chars (no strcmp, ISR)
+    const char* textB = RowText(b,ii);
+    for (uint8_t jj=0;jj<a->len[ii];jj++) {
+      if ( textA[jj]!=textB[jj] ) return false;
+    }
+  }   // end of row loop
+  return  true;
+}   // end of SameRecord
+
+//****************************************************************************************/
+void OLED_ISR_ATTR Oled_1306::CopyRecord(OledStackDef* to, const OledStackDef* from) {
+  /*
+   * producer: method to copy a record (no memcpy, ISR)
+   */
+  const uint8_t* source = (const uint8_t*)from;
+  uint8_t*  dest = (uint8_t*)to;
+  for (uint8_t ii=0;ii<sizeof(OledStackDef);ii++) dest[ii] = source[ii];
+}   // end of CopyRecord
+
+//****************************************************************************************/
+OledQueueStats Oled_1306::QueueStatsOLED() {
+  /*
+   * method to return the queue push statistics (counters since begin)
+   */
+  return  _Queue;
+}   // end of QueueStatsOLED
+
+//****************************************************************************************/
+void OLED_ISR_ATTR Oled_1306::FlushQueue(uint8_t lane) {
+  /*
+   * producer: method to request dropping all entries queued so far in <lane>
+   */
+  _flushMark[lane] = _head[lane];
+  OLED_BARRIER();
+  _flushSeq[lane]++;
+}   // end of FlushQueue
+
+//****************************************************************************************/
+void Oled_1306::ApplyFlush(uint8_t lane) {
+  /*
+   * consumer: method to drop entries of <lane> before the flush mark of its latest flush request
+   * the mark is applied only while it is still ahead of the tail
+   */
+  uint8_t seq = _flushSeq[lane];
+  if ( seq==_flushSeen[lane] ) return;
+  _flushSeen[lane] = seq;
+  OLED_BARRIER();
+  uint8_t mark  = _flushMark[lane];
+  uint8_t tail  = _tail[lane];
+  uint8_t count = OLED_DEPTH(_head[lane],tail,lane);
+  uint8_t skip  = OLED_DEPTH(mark,tail,lane);
+  if ( skip<=count ) _tail[lane] = mark;
+  if ( lane==_stackLane ) _scrollNext = false;              // flush also ends a scroll in progress
+  _resume &= ~(1<<lane);                                    // and the interrupted record of the lane
+}   // end of ApplyFlush
+
+//****************************************************************************************/
+bool Oled_1306::PeekQueue(uint8_t lane, OledStackDef* record) {
+  /*
+   * consumer: method to copy the oldest record of <lane> without removing it
+   * returns  - 1 - record copied; 0 - lane empty
+   */
+  ApplyFlush(lane);
+  uint8_t tail = _tail[lane];
+  if ( tail==_head[lane] ) return false;                    // empty
+  OLED_BARRIER();
+  memcpy(record,&_Ring[OLED_LANEBASE(lane)+tail],sizeof(OledStackDef));
+  return  true;
+}   // end of PeekQueue
+
+//****************************************************************************************/
+bool Oled_1306::PopQueue(uint8_t lane, OledStackDef* record) {
+  /*
+   * consumer: method to copy and remove the oldest record of <lane>
+   * returns  - 1 - record copied; 0 - lane empty
+   */
+  if ( !PeekQueue(lane,record) ) return false;
+  OLED_BARRIER();                                           // slot read before it is released
+  _tail[lane] = OLED_NEXT(_tail[lane],lane);
+  return  true;
+}   // end of PopQueue
+
+//****************************************************************************************/
+void Oled_1306::ReleaseArena() {
+  /*
+   * consumer: method to release the arena up to the oldest payloads still in use: of the queued records
+   * of every lane, the record on display and the interrupted records. The lanes are popped in any
+   * order, so the release is not FIFO per record; a payload freed early waits for the older ones
+   */
+  uint16_t  head = _arenaHead;                              // pushed later: at <head> or past it
+  OLED_BARRIER();
+  uint16_t  tail = _arenaTail;
+  uint16_t  oldest = (head+OLED_ARENALEN-tail) % OLED_ARENALEN;     // from <tail>
+  ArenaOldest(&_Stack,tail,oldest);
+  for (uint8_t lane=0;lane<OLED_LANES;lane++) {
+    if ( lane<OLED_LANES-1 && (_resume&(1<<lane)) ) ArenaOldest(&_Resume[lane],tail,oldest);
+    for (uint8_t ii=_tail[lane];ii!=_head[lane];ii=OLED_NEXT(ii,lane)) ArenaOldest(&_Ring[OLED_LANEBASE(lane)+ii],tail,oldest);
+  }   // end of lane loop
+  tail += oldest;
+  _arenaTail = tail>=OLED_ARENALEN ? tail-OLED_ARENALEN : tail;     // 0..<OLED_ARENALEN>-1, as the head
+}   // end of ReleaseArena
+
+//****************************************************************************************/
+void Oled_1306::ArenaOldest(const OledStackDef* record, uint16_t tail, uint16_t &oldest) {
+  /*
+   * method to lower <oldest> (bytes from the arena <tail>) to the payloads of <record>, when it has any
+   */
+  if ( record->textLen==0 ) return;
+  uint16_t  from = (record->textAt+OLED_ARENALEN-tail) % OLED_ARENALEN;
+  if ( from<oldest ) oldest = from;
+}   // end of ArenaOldest
+
+//****************************************************************************************/
+uint8_t Oled_1306::TopLane() {
+  /*
+   * consumer: method to return the highest lane holding records, <OLED_LANES> - all empty
+   */
+  for (uint8_t lane=OLED_LANES;lane>0;lane--) {
+    ApplyFlush(lane-1);
+    if ( _tail[lane-1]!=_head[lane-1] ) return lane-1;
+  }
+  return  OLED_LANES;
+}   // end of TopLane
+
+//****************************************************************************************/
+uint8_t Oled_1306::NextSource() {
+  /*
+   * consumer: method to select what PopQueueDisplayOLED displays next
+   *  - a scroll in progress goes on, unless a record of the same lane (cancels it) or of a higher
+   *    lane (preempts it, the record is kept to resume) is queued
+   *  - else the interrupted record of the highest lane resumes, ahead of the records of lower lanes
+   *  - else the oldest record of the highest lane
+   * returns  lane {0,...} to pop, <OLED_NEXT_SCROLL>, <OLED_NEXT_RESUME>+lane, <OLED_NEXT_EMPTY>
+   */
+  uint8_t lane = TopLane();
+  if ( _scrollNext ) {
+    if ( lane<OLED_LANES && lane>=_stackLane ) return lane;
+    return  OLED_NEXT_SCROLL;
+  }
+  for (uint8_t resume=OLED_LANES;resume>0;resume--) {       // highest interrupted record
+    if ( (_resume&(1<<(resume-1)))==0 ) continue;
+    if ( lane>=OLED_LANES || resume-1>lane ) return OLED_NEXT_RESUME+resume-1;
+    break;
+  }
+  return  lane<OLED_LANES ? lane : OLED_NEXT_EMPTY;
+}   // end of NextSource
+
 //****************************************************************************************/
 uint8_t Oled_1306::InQueueOLED() {
   /*
-   * method to return how many records are in the queue stack
+   * method to return how many records are in the queue stack (all lanes)
    */
   if ( !_activate ) return 0;                               // the library not activated
-  //Serial.print(F("Oled1306::info number of records stored in the queue=")); Serial.print(ShowOLED.getCount()); Serial.print(F("\n"));
-  //Serial.print(F("Oled1306::info number of records left  empty in the queue=")); Serial.print(ShowOLED.getRemainingCount()); Serial.print(F("\n")); 
-  return ShowOLED.getCount();
+  uint8_t count = 0;
+  for (uint8_t lane=0;lane<OLED_LANES;lane++) {
+    ApplyFlush(lane);
+    count += OLED_DEPTH(_head[lane],_tail[lane],lane);
+    if ( _resume&(1<<lane) ) count++;                       // an interrupted record counts as a record
+  }
+  return  count + (_scrollNext ? 1 : 0);                    // a pending scroll step counts as a record
 }     // end of InQueueOLED
 
 // ****************************************************************************************/
@@ -614,20 +1744,33 @@ uint8_t Oled_1306::PeekQueueOLED() {
    */
   if ( !_activate ) return 0;                               // the library not activated
   OledStackDef _Stack;
-                                                            // retrieve from stack
-  if (ShowOLED.isEmpty()) {                                 // queue is empty
-    return 0; 
-  }   // end stack is empty
-  
-  ShowOLED.peek(&_Stack);                                    // retieve (pop) data to be displayed
+  uint8_t source = NextSource();                            // retrieve from stack
+  if ( source==OLED_NEXT_EMPTY ) return 0;                   // queue is empty
+  if ( source==OLED_NEXT_SCROLL ) _Stack = this->_Stack;     // next scroll step
+  else if ( source>=OLED_NEXT_RESUME ) _Stack = _Resume[source-OLED_NEXT_RESUME];
+  else PeekQueue(source,&_Stack);
   #if _DEBUGOLED==1
     Serial.print("ACK 00:00:00 PeekQueueOLED style="); Serial.print(_Stack.style); Serial.print(" scroll="); Serial.print(_Stack.scroll); 
-    Serial.print(" Stack:["); Serial.print(_Stack.payload0); Serial.print("] ["); Serial.print(_Stack.payload1); 
-    Serial.print("] ["); Serial.print(_Stack.payload2); Serial.print("] -END\n");
+    Serial.print(" Stack:"); PrintRecord(&_Stack); Serial.print(" -END\n");
   #endif  //_DEBUGOLED
   return  _Stack.style;
 }     // end of PeekQueueOLED
 
+//****************************************************************************************/
+void Oled_1306::PrintRecord(const OledStackDef* record) {
+  /*
+   * method to print the 3 payloads of a record (debug)
+   */
+  for (uint8_t ii=0;ii<3;ii++) {
+    const char* text = RowText(record,ii);
+    Serial.print("[");
+    if ( record->src[ii]==OLED_SRC_CLOCK ) Serial.print(F("Timestamp"));
+    else if ( record->src[ii]==OLED_SRC_PGM ) Serial.print((const __FlashStringHelper*)text);
+    else if ( text!=nullptr ) Serial.print(text);
+    Serial.print("]");
+  }   // end of row loop
+}   // end of PrintRecord
+
 //****************************************************************************************/
 void Oled_1306::DisplayProg( TimePack _SysClock, uint8_t type, const char* row0_const, 
                             const char* row1_const, const char* row2_const) {
@@ -647,43 +1790,8 @@ void Oled_1306::DisplayProg( TimePack _SysClock, uint8_t type, const char* row0_
    * <row1_const> - pointer to PROG MEM data for row 1
    * <row2_const> - pointer to PROG MEM data for row 2 (optional argument for type {1,3})
    */
-  uint8_t len0=0;
-  uint8_t len1=0;
-  uint8_t len2=0;
-  if ( row0_const!=nullptr ) len0 = strlen(row0_const);
-  if ( len0>PAYLOADMAXLEN ) return;                       // error
-  if ( row1_const!=nullptr )  len1 = strlen(row1_const);
-  if ( len1>PAYLOADMAXLEN ) return;                       // error
-  if ( row2_const!=nullptr )  len2 = strlen(row2_const);
-  if ( len2>PAYLOADMAXLEN ) return;                       // error
-  
-  OLED_display.clearDisplay();                            // Clear display buffer
-  OLED_display.setTextColor(WHITE);
-  OLED_display.setFont();                                 // return to dealt font
-  if ( len0>0 ) DisplayLine( OLED_Start_row_0,len0,OLED_CharSize_row_0,row0_const);
-
-  switch ( type ) {
-    case  0:                                              // 0 - 3 provided lines size 2,3,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_1,len1,OLED_CharSize_row_1,row1_const);
-      if ( len2>0 ) DisplayLine( OLED_Start_row_2,len2,OLED_CharSize_row_2,row2_const);
-      break;
-    case  1:                                              // 1 - 2 provided lines, line 3 is time, size 2,3,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_1,len1,OLED_CharSize_row_1,row1_const);
-      SetTimeToRow2(_SysClock);
-      break;
-    case  2:                                              // 0 - 3 provided lines size 2,2,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_3,len1,OLED_CharSize_row_3,row1_const);
-      if ( len2>0 ) DisplayLine( OLED_Start_row_2,len2,OLED_CharSize_row_2,row2_const);
-      break;
-    case  3:                                              // 1 - 2 provided lines, line 3 is time, size 2,2,2
-      if ( len1>0 ) DisplayLine( OLED_Start_row_3,len1,OLED_CharSize_row_3,row1_const);
-      SetTimeToRow2(_SysClock);
-      break;
-    case  4:
-    default:
-      break;
-  } // end of type 
-  OLED_display.display();                                 // display
+  OledTextRun rows[3] = {TextRunOLED(row0_const,true),TextRunOLED(row1_const,true),TextRunOLED(row2_const,true)};
+  DisplayRows(_SysClock,TypeLayout(type),rows);
 }   // end of DisplayProg
 
 //****************************************************************************************/
@@ -691,38 +1799,663 @@ void Oled_1306::SetCharsToRow(char* buffer, uint8_t row) {
   /*
    * method to display chars on OLED row
    * <buffer> - pointer to chars to display. must end with 0x00
-   *            length is limitted to <PAYLOADMAXLEN> (overflow might occur)
+   *            length is limitted to <PAYLOADMAXLEN>
    * <row>    - row number {0,1,2,3}
    *            (row 3 is actually row 1 half size font)
    */
-  char* pntr;
-  if ( strlen(buffer)>PAYLOADMAXLEN ) return;             // error
-  
-  OLED_display.setTextColor(WHITE);
-  OLED_display.setFont();                                 // return to dealt font
-  switch ( row ) {
-    case  0:
-      OLED_display.setTextSize(OLED_CharSize_row_0);      // value {1,...,8}
-      OLED_display.setCursor(0,OLED_Start_row_0);         // point to row start
-      break;
+  DrawRunOLED(TextRunOLED(buffer),row);                   // measured once, rendered as one run
+}   // end of SetCharsToRow
+
+//****************************************************************************************/
+bool Oled_1306::BlitText(uint8_t start, uint8_t size, const char* text, uint8_t length, int16_t x0) {
+  /*
+   * method to render text straight into the page organized frame buffer
+   * same result as Adafruit_GFX print with the classic font, WHITE transparent text and wrap on,
+   * but each glyph column is scaled with a lookup table and OR-ed as whole bytes, one per page
+   * <start>    - row start in pixels; must be page aligned (multiple of 8)
+   * <size>     - text size {1,2,3}
+   * <text>     - pointer to chars (regular memory), <length> chars are rendered
+   * <x0>       - start column of the first char
+   * returns  1 - text rendered, GFX cursor moved past the text
+   *          0 - not handled (fast text off, unaligned row or size) - use GFX print
+   */
+  #if OLED_FASTTEXT==1
+    uint8_t*  buffer = _display.getBuffer();
+    if ( !_fastText || buffer==nullptr ) return false;
+    if ( (start&0x07)!=0 || size<1 || size>3 ) return false;
+    int16_t   x = x0;
+    int16_t   y = start;
+    for (uint8_t ii=0;ii<length;ii++) {
+      uint8_t c = text[ii];
+      if ( c=='\n' ) {                                    // new line as GFX
+        x = 0;
+        y += size*8;
+        continue;
+      }
+      if ( c=='\r' ) continue;
+      if ( x+size*6>SCREEN_WIDTH ) {                      // wrap as GFX
+        x = 0;
+        y += size*8;
+      }
+      if ( y<SCREEN_HEIGHT ) {
+        uint8_t page = y>>3;
+        if ( c>=176 ) c++;                                // GFX classic font index (cp437 off)
+        for (uint8_t col=0;col<5;col++) {                 // 6th column is blank
+          uint8_t   line = pgm_read_byte(&font[c*5+col]);
+          uint32_t  bits = ScaleColumn(line,size);
+          for (uint8_t sx=0;sx<size;sx++) {               // scale horizontally
+            int16_t cx = x+col*size+sx;
+            if ( cx>=SCREEN_WIDTH ) break;
+            uint32_t  column = bits;
+            for (uint8_t sp=0;sp<size && page+sp<SCREEN_PAGES;sp++) {
+              buffer[(page+sp)*SCREEN_WIDTH+cx] |= (uint8_t)column;
+              column >>= 8;
+            }
+          }   // end of horizontal scale
+        }   // end of glyph columns
+      }   // end of visible glyph
+      x += size*6;
+    }   // end of text
+    _display.setCursor(x,y);
+    return  true;
+  #else
+    (void)start; (void)size; (void)text; (void)length; (void)x0;
+    return  false;
+  #endif  //OLED_FASTTEXT
+}   // end of BlitText
+
+//****************************************************************************************/
+uint32_t Oled_1306::ScaleColumn(uint8_t line, uint8_t size) {
+  /*
+   * method to scale a font column (bit 0 on top) vertically by <size> {1,2,3}
+   * returns the column bits, 8*<size> bits, one byte per page from the lowest byte
+   */
+  switch ( size ) {
+    case  2:
+      return  pgm_read_byte(&OLED_Scale2[line&0x0F]) | (pgm_read_byte(&OLED_Scale2[line>>4])<<8);
+    case  3:
+      return  pgm_read_word(&OLED_Scale3[line&0x0F]) | ((uint32_t)pgm_read_word(&OLED_Scale3[line>>4])<<12);
+    default:
+      return  line;
+  }   // end of scale
+}   // end of ScaleColumn
+
+//****************************************************************************************/
+uint32_t Oled_1306::GlyphColumn(uint8_t c, uint8_t col, uint8_t size) {
+  /*
+   * method to return column <col> {0,...,5} of char <c> in the classic font, scaled by <size> {1,2,3}
+   * returns the column bits as ScaleColumn (the 6th column is blank)
+   */
+  if ( col>=5 ) return 0;
+  if ( c>=176 ) c++;                                      // GFX classic font index (cp437 off)
+  return  ScaleColumn(pgm_read_byte(&font[c*5+col]),size);
+}   // end of GlyphColumn
+
+//****************************************************************************************/
+const OledLayoutDef* Oled_1306::TypeLayout(uint8_t type) {
+  /*
+   * method to return the layout of DisplayMemory/DisplayProg <type> {0,1,2,3}, other - top line only
+   */
+  return  &OLED_Types[type<4 ? type : 4];
+}   // end of TypeLayout
+
+//****************************************************************************************/
+void Oled_1306::SetFastTextOLED(bool fast) {
+  /*
+   * method to select the text renderer: 1 - page aligned blitter (default), 0 - Adafruit_GFX print
+   */
+  _fastText = fast;
+}   // end of SetFastTextOLED
+
+//****************************************************************************************/
+void Oled_1306::FlushOLED() {
+  /*
+   * method to transfer the frame buffer to the panel
+   * with <OLED_PARTIALFLUSH> set, each page is compared against the shadow copy of the panel GDDRAM
+   * and only the column window [first..last changed column] is sent, using the page/column address
+   * commands. A full frame is sent when the shadow is not valid (after begin or hardware scroll).
+   * in async flush mode (SetFlushModeOLED) the transfer is only started here and advanced page by
+   * page by ServiceOLED; the frame buffer must not be drawn into until BusyOLED returns false.
+   * double buffered (SetDoubleBufferOLED), the frame goes to the front buffer and drawing goes on in
+   * the back buffer; a frame flushed while another is in transfer waits and is sent right after it.
+   */
+  if ( !_activate ) return;                               // the library not activated
+  #if OLED_PARTIALFLUSH==1
+    if ( _display.getBuffer()==nullptr ) return;      // display not started
+    if ( _spare!=nullptr && _flushBusy ) {                // double buffer: send after the frame in transfer
+      _presentPending = true;
+      OLED_STAT( _pendingStyle = _drawStyle; )
+      return;
+    }
+    FinishFlush();                                        // complete a previous frame
+    StartFlush();
+    OLED_STAT( _frameStyle = _drawStyle; )
+    if ( !_asyncFlush ) {                                 // blocking mode - send all pages now
+      while ( _flushBusy ) FlushStep();
+    }
+  #else
+    OLED_STAT( uint32_t statStart = micros(); )
+    _display.display();
+    #if _STATSOLED==1
+      uint32_t  statFlush = micros()-statStart;
+      _statFlushTime += statFlush;
+      _Stats.flushTime[_drawStyle] += statFlush;
+      _Stats.frames++;
+      StatFrame(_frameRender+statFlush);
+    #endif  //_STATSOLED
+    _bus->Count(1+(SCREEN_BUFSIZE+OLED_I2CCHUNK-1)/OLED_I2CCHUNK,SCREEN_BUFSIZE,SCREEN_BUFSIZE);   // Adafruit overhead not counted
+    _Flush.flushes++;
+  #endif  //OLED_PARTIALFLUSH
+}   // end of FlushOLED
+
+//****************************************************************************************/
+bool Oled_1306::ServiceOLED() {
+  /*
+   * method to advance an async flush, the live clock and the marquees; call from loop()
+   * sends at least one page and continues while the time spent is below the flush budget
+   * returns  1 - flush still in progress (busy)
+   *          0 - idle
+   */
+  TickIdle();                                             // live time row and marquees
+  if ( !_flushBusy ) return false;
+  uint32_t  start = micros();
+  do {
+    FlushStep();
+  } while ( _flushBusy && (uint32_t)(micros()-start)<_flushBudget );
+  return  _flushBusy;
+}   // end of ServiceOLED
+
+//****************************************************************************************/
+bool Oled_1306::ServiceAllOLED(uint16_t budget) {
+  /*
+   * bus arbiter: method to advance the async flushes of all panels; call from loop() instead of
+   * ServiceOLED of each panel
+   * the busy panels are served one page at a time in turn, so frames of several panels are sent
+   * interleaved and a large frame of one panel does not hold the others until it completes
+   * <budget>     - max uS per call, 0 - the default <OLED_FLUSHBUDGET>; at least one page is sent
+   * returns  1 - a flush is still in progress on one of the panels
+   *          0 - all idle
+   */
+  if ( budget==0 ) budget = OLED_FLUSHBUDGET;
+  for (uint8_t ii=0;ii<_panelCount;ii++) {                // live time rows and marquees
+    if ( _Panels[ii]->_activate ) _Panels[ii]->TickIdle();
+  }
+  uint32_t  start = micros();
+  bool      busy;
+  do {
+    busy = false;
+    for (uint8_t ii=0;ii<_panelCount;ii++) {              // one page of each busy panel, round robin
+      Oled_1306* panel = _Panels[_panelNext];
+      _panelNext = _panelNext+1>=_panelCount ? 0 : _panelNext+1;
+      if ( !panel->_flushBusy ) continue;
+      panel->FlushStep();
+      if ( panel->_flushBusy ) busy = true;
+    }   // end of panel loop
+  } while ( busy && (uint32_t)(micros()-start)<budget );
+  return  busy;
+}   // end of ServiceAllOLED
+
+//****************************************************************************************/
+void Oled_1306::TickIdle() {
+  /*
+   * method to advance the live time row and the marquees, and start the flush of what changed
+   * nothing is drawn while a frame transfer is in progress
+   */
+  if ( _flushBusy ) return;
+  bool  changed = TickClock();
+  if ( StepMarquee() ) changed = true;
+  if ( changed ) FlushOLED();
+}   // end of TickIdle
+
+//****************************************************************************************/
+bool Oled_1306::BusyOLED() {
+  /*
+   * method to report a flush in progress (frame buffer must not be drawn into)
+   */
+  return  _flushBusy;
+}   // end of BusyOLED
+
+//****************************************************************************************/
+void Oled_1306::SetFlushModeOLED(bool async, uint16_t budget) {
+  /*
+   * method to select the flush mode
+   * <async>    - 0 - FlushOLED blocks until the frame is sent
+   *              1 - FlushOLED starts the transfer, ServiceOLED advances it
+   * <budget>   - max time [uS] ServiceOLED spends per call (at least one page is sent)
+   *              0 - use <OLED_FLUSHBUDGET>
+   */
+  FinishFlush();                                          // do not switch mode mid frame
+  _asyncFlush = async;
+  _flushBudget = budget==0 ? OLED_FLUSHBUDGET : budget;
+}   // end of SetFlushModeOLED
+
+//****************************************************************************************/
+OledPerfStats Oled_1306::StatsOLED() {
+  /*
+   * method to return the display pipeline counters since begin or the last ResetStatsOLED
+   * <fps10> is computed here: frames sent per 10 seconds over that period
+   * bytes and transactions on the bus are in FlushStatsOLED, pushes in QueueStatsOLED
+   * with <_STATSOLED> 0 all counters read 0 and nothing is measured
+   */
+  #if _STATSOLED==1
+    OledPerfStats stats = _Stats;
+    uint32_t  elapsed = millis()-_statsSince;
+    stats.failedPushes = _Queue.dropped-_statsDropped;
+    stats.fps10 = elapsed==0 ? 0 : (uint32_t)((uint64_t)stats.frames*10000/elapsed);
+    return  stats;
+  #else
+    OledPerfStats stats;
+    memset(&stats,0,sizeof(stats));
+    return  stats;
+  #endif  //_STATSOLED
+}   // end of StatsOLED
+
+//****************************************************************************************/
+void Oled_1306::ResetStatsOLED() {
+  /*
+   * method to restart the display pipeline counters (StatsOLED)
+   */
+  #if _STATSOLED==1
+    memset(&_Stats,0,sizeof(_Stats));
+    _statsSince = millis();
+    _statsDropped = _Queue.dropped;
+  #endif  //_STATSOLED
+}   // end of ResetStatsOLED
+
+//****************************************************************************************/
+void Oled_1306::StatFrame(uint32_t frameTime) {
+  /*
+   * method to sample a frame time (render and transfer) into the histogram
+   * bin <n> counts frames below <OLED_HISTBASE>*2^n uS, the last bin all the longer ones
+   */
+  #if _STATSOLED==1 && OLED_STATSHIST>0
+    uint8_t   bin = 0;
+    uint32_t  limit = OLED_HISTBASE;
+    while ( bin<OLED_STATSHIST-1 && frameTime>=limit ) {
+      bin++;
+      limit <<= 1;
+    }
+    _Stats.histogram[bin]++;
+  #else
+    (void)frameTime;
+  #endif  //_STATSOLED
+}   // end of StatFrame
+
+//****************************************************************************************/
+void Oled_1306::SetMirrorOLED(Print* out) {
+  /*
+   * method to send the frame mirroring stream (see OledMirror.h) to a stream: Serial, a WiFiClient ...
+   * each flushed frame is sent as the XOR of its changed windows against the previous frame, RLE coded
+   * the first frame is a key frame (full image); hardware scroll is not mirrored
+   * <out>    - nullptr - stop mirroring
+   */
+  #if OLED_MIRROR==1
+    FinishFlush();                                        // start on a frame boundary
+    _mirrorOut = out;
+    _mirrorSink = nullptr;
+    _mirrorKey = true;
+  #else
+    (void)out;
+  #endif  //OLED_MIRROR
+}   // end of SetMirrorOLED
+
+//****************************************************************************************/
+void Oled_1306::SetMirrorOLED(OledMirrorSink sink, void* context) {
+  /*
+   * method to send the frame mirroring stream to a callback, as above
+   * <sink>     - called with parts of the stream, nullptr - stop mirroring
+   * <context>  - passed to <sink>
+   */
+  #if OLED_MIRROR==1
+    FinishFlush();
+    _mirrorOut = nullptr;
+    _mirrorSink = sink;
+    _mirrorContext = context;
+    _mirrorKey = true;
+  #else
+    (void)sink; (void)context;
+  #endif  //OLED_MIRROR
+}   // end of SetMirrorOLED
+
+//****************************************************************************************/
+void Oled_1306::MirrorKeyOLED() {
+  /*
+   * method to send the next frame in full (e.g. a viewer connected or OledMirror::NeedKey)
+   * the panel itself still gets only the changed windows; the frame is sent on the next flush
+   */
+  #if OLED_MIRROR==1
+    _mirrorKey = true;
+  #endif  //OLED_MIRROR
+}   // end of MirrorKeyOLED
+
+//****************************************************************************************/
+void Oled_1306::MirrorWindow(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data, const uint8_t* prev) {
+  /*
+   * method to code one window: its bytes XOR the previous frame (<prev> nullptr - blank, key frame)
+   * runs of 3 or more equal bytes (mostly 0 - unchanged) are sent as a repeat, the rest as literals
+   */
+  #if OLED_MIRROR==1
+    if ( !_mirrorOpen ) {                                 // frame header on the first window
+      MirrorPut(OLEDMIRROR_MAGIC);
+      MirrorPut(_mirrorFrameKey ? OLEDMIRROR_KEY : 0x00);
+      MirrorPut(_mirrorSeq);
+      MirrorPut(SCREEN_WIDTH);
+      MirrorPut(SCREEN_PAGES);
+      _mirrorOpen = true;
+    }
+    MirrorPut(page);
+    MirrorPut(col0);
+    MirrorPut(col1);
+    uint8_t length = col1-col0+1;
+    uint8_t literal = 0;                                  // literal bytes pending at <ii>-<literal>
+    uint8_t ii = 0;
+    while ( ii<length ) {
+      uint8_t value = data[ii]^(prev==nullptr ? 0 : prev[ii]);
+      uint8_t run = 1;
+      while ( ii+run<length && run<128 && (uint8_t)(data[ii+run]^(prev==nullptr ? 0 : prev[ii+run]))==value ) run++;
+      if ( run>=3 ) {
+        if ( literal>0 ) MirrorLiteral(&data[ii-literal],prev==nullptr ? nullptr : &prev[ii-literal],literal);
+        literal = 0;
+        MirrorPut(OLEDMIRROR_RUN+run-1);
+        MirrorPut(value);
+        ii += run;
+        continue;
+      }
+      ii += run;
+      literal += run;
+    }   // end of window loop
+    if ( literal>0 ) MirrorLiteral(&data[ii-literal],prev==nullptr ? nullptr : &prev[ii-literal],literal);
+  #else
+    (void)page; (void)col0; (void)col1; (void)data; (void)prev;
+  #endif  //OLED_MIRROR
+}   // end of MirrorWindow
+
+//****************************************************************************************/
+void Oled_1306::MirrorLiteral(const uint8_t* data, const uint8_t* prev, uint8_t length) {
+  /*
+   * method to send <length> window bytes XOR the previous frame as literals, 128 at most per control
+   */
+  #if OLED_MIRROR==1
+    while ( length>0 ) {
+      uint8_t count = length>128 ? 128 : length;
+      MirrorPut(count-1);
+      for (uint8_t ii=0;ii<count;ii++) MirrorPut(data[ii]^(prev==nullptr ? 0 : prev[ii]));
+      data += count;
+      if ( prev!=nullptr ) prev += count;
+      length -= count;
+    }
+  #else
+    (void)data; (void)prev; (void)length;
+  #endif  //OLED_MIRROR
+}   // end of MirrorLiteral
+
+//****************************************************************************************/
+void Oled_1306::MirrorPut(uint8_t value) {
+  /*
+   * method to add one byte to the mirror stream, handed to the sink when the chunk is full
+   */
+  #if OLED_MIRROR==1
+    _mirrorBuf[_mirrorLen++] = value;
+    if ( _mirrorLen>=OLED_MIRRORCHUNK ) MirrorSend();
+  #else
+    (void)value;
+  #endif  //OLED_MIRROR
+}   // end of MirrorPut
+
+//****************************************************************************************/
+void Oled_1306::MirrorSend() {
+  /*
+   * method to hand the pending mirror bytes to the sink
+   */
+  #if OLED_MIRROR==1
+    if ( _mirrorLen==0 ) return;
+    if ( _mirrorOut!=nullptr ) _mirrorOut->write(_mirrorBuf,_mirrorLen);
+    else if ( _mirrorSink!=nullptr ) _mirrorSink(_mirrorBuf,_mirrorLen,_mirrorContext);
+    _Flush.mirrorBytes += _mirrorLen;
+    _mirrorLen = 0;
+  #endif  //OLED_MIRROR
+}   // end of MirrorSend
+
+//****************************************************************************************/
+void Oled_1306::FinishFlush() {
+  /*
+   * method to complete a flush in progress (blocking), before the frame buffer is modified
+   */
+  if ( !_flushBusy ) return;
+  OLED_STAT( uint32_t statStart = micros(); )
+  while ( _flushBusy ) FlushStep();
+  OLED_STAT( _Stats.blockedTime += micros()-statStart; )
+}   // end of FinishFlush
+
+//****************************************************************************************/
+void Oled_1306::StartFlush() {
+  /*
+   * method to start the transfer of the frame buffer; double buffered, the buffers are swapped
+   * and the back buffer starts as a copy of the frame sent, so drawing goes on from it
+   */
+  #if OLED_PARTIALFLUSH==1
+    if ( _scrolling ) {                                   // GDDRAM must not be written while scrolling
+      _display.stopscroll();
+      _scrolling = false;
+    }
+    _front = _display.getBuffer();
+    if ( _spare!=nullptr ) {                              // swap by pointer
+      _display.SwapBuffer(_spare);
+      memcpy(_spare,_front,SCREEN_BUFSIZE);
+      _spare = _front;
+    }
+    _flushPage = 0;
+    _flushFull = !_shadowValid;
+    _flushStart = _bus->Stats().bytes;
+    _bus->Invalidate();                                   // panel commands may have moved the GDDRAM pointer
+    _flushBusy = true;
+    OLED_STAT( _frameFlush = 0; )
+  #endif  //OLED_PARTIALFLUSH
+}   // end of StartFlush
+
+//****************************************************************************************/
+bool Oled_1306::SetDoubleBufferOLED(bool on) {
+  /*
+   * method to select double buffering: a second frame buffer is allocated, so the next record is
+   * drawn while the previous frame is still in transfer (async flush mode, SetFlushModeOLED)
+   * PopQueueDisplayOLED then returns 4 (busy) only when a drawn frame is already waiting
+   * returns  1 - double buffering on
+   *          0 - off (or no memory, or <OLED_PARTIALFLUSH> 0)
+   */
+  #if OLED_PARTIALFLUSH==1
+    FinishFlush();                                        // both buffers are free
+    if ( !on ) {
+      free(_spare);
+      _spare = nullptr;
+      return  false;
+    }
+    if ( _spare==nullptr ) _spare = (uint8_t*)malloc(SCREEN_BUFSIZE);
+    return  _spare!=nullptr;
+  #else
+    (void)on;
+    return  false;
+  #endif  //OLED_PARTIALFLUSH
+}   // end of SetDoubleBufferOLED
+
+//****************************************************************************************/
+void Oled_1306::DrawReady() {
+  /*
+   * method to wait until the frame buffer can be drawn into
+   * single buffer - the frame in transfer is completed
+   * double buffer - only a drawn frame waiting for its transfer holds the buffer
+   */
+  if ( _spare==nullptr ) {
+    FinishFlush();
+    return;
+  }
+  if ( !_presentPending ) return;
+  OLED_STAT( uint32_t statStart = micros(); )
+  while ( _presentPending ) FlushStep();                  // the waiting frame is started (swapped)
+  OLED_STAT( _Stats.blockedTime += micros()-statStart; )
+}   // end of DrawReady
+
+//****************************************************************************************/
+void Oled_1306::FlushStep() {
+  /*
+   * method to send the window of the next page of the frame in progress
+   * on the last page the frame is closed and a deferred hardware scroll is started
+   */
+  #if OLED_PARTIALFLUSH==1
+    uint8_t*  row = &_front[_flushPage*SCREEN_WIDTH];
+    uint8_t*  shadow = &_shadow[_flushPage*SCREEN_WIDTH];
+    int16_t   col0 = 0;
+    int16_t   col1 = SCREEN_WIDTH-1;
+    if ( !_flushFull ) {                                    // find changed window of the page
+      while ( col0<=col1 && row[col0]==shadow[col0] ) col0++;
+      if ( col0<=col1 ) while ( row[col1]==shadow[col1] ) col1--;
+    }
+    #if OLED_MIRROR==1
+      if ( _mirrorOut!=nullptr || _mirrorSink!=nullptr ) {  // mirror the page before the shadow moves on
+        if ( _flushPage==0 ) _mirrorFrameKey = _mirrorKey || _flushFull;
+        if ( _mirrorFrameKey ) MirrorWindow(_flushPage,0,SCREEN_WIDTH-1,row,nullptr);
+        else if ( col0<=col1 ) MirrorWindow(_flushPage,col0,col1,&row[col0],&shadow[col0]);
+      }
+    #endif  //OLED_MIRROR
+    if ( col0<=col1 ) {                                     // page changed
+      OLED_STAT( uint32_t statStart = micros(); )
+      SendWindow(_flushPage,col0,col1,&row[col0]);
+      memcpy(&shadow[col0],&row[col0],col1-col0+1);
+      OLED_STAT( uint32_t statFlush = micros()-statStart; )
+      OLED_STAT( _statFlushTime += statFlush; )
+      OLED_STAT( _frameFlush += statFlush; )
+    }
+    if ( ++_flushPage<SCREEN_PAGES ) return;
+                                                            // frame completed
+    #if _STATSOLED==1
+      _Stats.flushTime[_frameStyle] += _frameFlush;
+      _Stats.frames++;
+      StatFrame(_frameRender+_frameFlush);
+      _frameRender = 0;
+    #endif  //_STATSOLED
+    uint32_t  sent = _bus->Stats().bytes-_flushStart;
+    if ( sent<SCREEN_BUFSIZE ) _Flush.bytesSaved += SCREEN_BUFSIZE-sent;
+    _Flush.flushes++;
+    _shadowValid = true;
+    _flushBusy = false;
+    #if OLED_MIRROR==1
+      if ( _mirrorOpen ) {                                  // close the mirror frame
+        MirrorPut(OLEDMIRROR_END);
+        MirrorSend();
+        _mirrorOpen = false;
+        if ( _mirrorFrameKey ) _mirrorKey = false;
+        _mirrorSeq++;
+        _Flush.mirrorFrames++;
+      }
+    #endif  //OLED_MIRROR
+    if ( _presentPending ) {                                // double buffer: next frame waits
+      _presentPending = false;                              // the scroll request is for that frame
+      StartFlush();
+      OLED_STAT( _frameStyle = _pendingStyle; )
+      return;
+    }
+    if ( _pendingScroll!=0 ) {                              // scroll requested during the transfer
+      uint8_t mode = _pendingScroll-1;
+      _pendingScroll = 0;
+      ScrollOLED(mode);
+    }
+  #endif  //OLED_PARTIALFLUSH
+}   // end of FlushStep
+
+//****************************************************************************************/
+void Oled_1306::ScrollOLED(uint8_t mode) {
+  /*
+   * method to start/stop the SSD1306 hardware scroll of the whole screen
+   * <mode>     - 0 - stop scroll
+   *              1 - scroll left
+   *              2 - scroll right
+   * a scroll requested while a flush is in progress is started when the frame is completed
+   */
+  if ( _flushBusy ) {                                     // defer until the frame is on the panel
+    _pendingScroll = mode+1;                              // 0 is reserved for none
+    return;
+  }
+  switch ( mode ) {
     case  1:
-      OLED_display.setTextSize(OLED_CharSize_row_1);      // value {1,...,8}
-      OLED_display.setCursor(0,OLED_Start_row_1);         // point to row start
+      _display.startscrollleft  (0x00, 0x0F);
       break;
     case  2:
-      OLED_display.setTextSize(OLED_CharSize_row_2);      // value {1,...,8}
-      OLED_display.setCursor(0,OLED_Start_row_2);         // point to row start
-      break;
-    case  3:
-      OLED_display.setTextSize(OLED_CharSize_row_3);      // value {1,...,8}
-      OLED_display.setCursor(0,OLED_Start_row_3);         // point to row start
+      _display.startscrollright (0x00, 0x0F);
       break;
-    default:                                              //error
+    case  0:
+    default:
+      _display.stopscroll();
+      _scrolling = false;
       return;
-  }   // end of row select
-  pntr = buffer;
-  for (uint8_t ii=0;ii<strlen(buffer);ii++) OLED_display.print(*pntr++);    
-}   // end of SetCharsToRow
+  }   // end of mode
+  _scrolling = true;
+  _shadowValid = false;                                   // hardware scroll moves GDDRAM content
+}   // end of ScrollOLED
+
+//****************************************************************************************/
+void Oled_1306::SendWindow(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data) {
+  /*
+   * method to send one GDDRAM window (single page, columns <col0>..<col1>) by the transport
+   * columns are of the panel; a panel narrower than the controller starts at GDDRAM column <colOffset>
+   */
+  _bus->Window(page,col0+OledPanelGeometry::colOffset,col1+OledPanelGeometry::colOffset,data,SCREEN_PAGES);
+  _Flush.windows++;
+}   // end of SendWindow
+
+//****************************************************************************************/
+void Oled_1306::SetTransportOLED(OledTransport* bus) {
+  /*
+   * method to send the frames by another transport (OledTransport.h), e.g. an OledMock on a host,
+   * or an OledI2C with a different chunk size; nullptr - back to the transport of the constructor
+   * the next frame is sent in full; the bus counters are those of the transport in use
+   */
+  FinishFlush();
+  _bus = bus==nullptr ? _busOwn : bus;
+  _shadowValid = false;
+}   // end of SetTransportOLED
+
+//****************************************************************************************/
+uint32_t Oled_1306::FrameCRCOLED() {
+  /*
+   * method to return the CRC-32 (IEEE 802.3) of the frame drawn last, for golden image checks
+   * the frame buffer is page organized (SCREEN_WIDTH bytes per page, bit 0 on top), so the value
+   * is the same on the unit and on a host build of the library
+   * returns  the CRC, 0 - no frame buffer (before begin, or the library not activated)
+   */
+  const uint8_t*  frame = _display.getBuffer();
+  if ( frame==nullptr ) return 0;                         // allocated by begin
+  uint32_t  crc = 0xFFFFFFFF;
+  for (uint16_t ii=0;ii<SCREEN_BUFSIZE;ii++) {
+    crc ^= frame[ii];
+    for (uint8_t bit=0;bit<8;bit++) crc = (crc>>1) ^ (0xEDB88320 & (0-(crc&0x01)));
+  }
+  return  ~crc;
+}   // end of FrameCRCOLED
+
+//****************************************************************************************/
+const uint8_t* Oled_1306::FrameOLED() {
+  /*
+   * method to return the frame drawn last: <SCREEN_BUFSIZE> bytes, <SCREEN_WIDTH> per page, bit 0 on top
+   * to dump a frame that failed its golden CRC
+   * returns  the frame buffer, nullptr - none (before begin, or the library not activated)
+   */
+  return  _display.getBuffer();
+}   // end of FrameOLED
+
+//****************************************************************************************/
+OledFlushStats Oled_1306::FlushStatsOLED() {
+  /*
+   * method to return the flush statistics (counters since begin)
+   * the bus counters and the payload efficiency [%] are read from the transport in use
+   */
+  OledBusStats  bus = _bus->Stats();
+  OledFlushStats  stats = _Flush;
+  stats.transactions = bus.transactions;
+  stats.bytesSent = bus.bytes;
+  stats.dataBytes = bus.payload;
+  stats.efficiency = bus.bytes==0 ? 0 : (uint8_t)((uint64_t)bus.payload*100/bus.bytes);
+  stats.arbiter = _arbiter;
+  return  stats;
+}   // end of FlushStatsOLED
 
 //****************************************************************************************/
 //****************************************************************************************/
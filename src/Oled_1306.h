@@ -6,8 +6,16 @@
  *  constructor:  Oled1306;
  *  methods:      begin; PopQueueDisplayOLED; PushQueueOLED; DisplayMemory; DisplayMix; DisplayLine; SetTimeToRow2;
  *                DrawLinePattern; DrawRecPattern; clear; show; InQueueOLED; getVersion;
- *                PeekQueueOLED; DisplayProg; SetCharsToRow;
+ *                PeekQueueOLED; DisplayProg; SetCharsToRow; FlushOLED; FlushStatsOLED;
+ *                ServiceOLED; BusyOLED; SetFlushModeOLED; SetFastTextOLED;
+ *                ReserveQueueOLED; CommitQueueOLED; QueueStatsOLED; SetLiveClockOLED;
+ *                TickOLED; SetDwellOLED; SetFrameRateOLED; MarqueeOLED; StopMarqueeOLED; SetMarqueeOLED;
+ *                ServiceAllOLED; StatsOLED; ResetStatsOLED; SetMirrorOLED; MirrorKeyOLED;
+ *                SetDoubleBufferOLED; SetTransportOLED; FrameCRCOLED; FrameOLED; PayloadQueueOLED;
+ *                TextRunOLED; DrawRunOLED; SetRenderCacheOLED; StartOLED; StartStepOLED;
+ *                SetStyleOLED; ScreenOLED; SetFieldOLED; RefreshScreenOLED;
  * 
+ *  16-X-2026  V3  [lock free queue with priority lanes, cppQueue dependency removed]
  *  29-XII-2024 V2  [rewrite for platformIO]
  *  10-VII-2024 ver 1
  */
@@ -16,15 +24,17 @@
 
   #include  "Arduino.h"
   #include  "stdlib.h"
+  #include  "Wire.h"
   #include  "Adafruit_GFX.h"
   #include  "Adafruit_SSD1306.h"                      // https://github.com/adafruit/Adafruit_SSD1306
-  #include  "cppQueue.h"                              // https://github.com/SMFSW/Queue/tree/master
 
   #include  "Clock.h"
   #include  "Utilities.h"
   #include  "WifiNet.h"
 
   #include  "OledConfig.h"                            // configuration by application file
+  #include  "OledMirror.h"                            // mirroring stream format
+  #include  "OledTransport.h"                         // flush transports (I2C, SPI, mock)
 
   #ifndef _LOGGMEOLED                                 // enable logging print
     #define _LOGGMEOLED 1
@@ -32,36 +42,265 @@
   #ifndef _DEBUGOLED                                  // endable debug prints
     #define _DEBUGOLED    0
   #endif  //_DEBUGOLED
+  #ifndef OLED_PARTIALFLUSH                           // 1 - send only changed GDDRAM windows; 0 - full frame display()
+    #define OLED_PARTIALFLUSH 1
+  #endif  //OLED_PARTIALFLUSH
+  #ifndef OLED_FASTTEXT                               // 1 - page aligned text blitter; 0 - Adafruit_GFX print only
+    #define OLED_FASTTEXT 1
+  #endif  //OLED_FASTTEXT
+  #ifndef OLED_ISR_ATTR                               // queue producer methods callable from a timer ISR
+    #if defined(ESP8266) || defined(ESP32)
+      #define OLED_ISR_ATTR IRAM_ATTR
+    #else
+      #define OLED_ISR_ATTR
+    #endif
+  #endif  //OLED_ISR_ATTR
+  #ifndef OLED_FLUSHBUDGET                            // async flush: max uS spent per ServiceOLED call
+    #define OLED_FLUSHBUDGET  2000
+  #endif  //OLED_FLUSHBUDGET
+  #ifndef _STATSOLED                                  // 1 - collect pipeline counters (StatsOLED); 0 - compiled out
+    #define _STATSOLED    1
+  #endif  //_STATSOLED
+  #ifndef OLED_STATSHIST                              // frame time histogram bins, 0 - no histogram
+    #define OLED_STATSHIST  0
+  #endif  //OLED_STATSHIST
+  #ifndef OLED_HISTBASE                               // upper limit of the first histogram bin [uS]
+    #define OLED_HISTBASE   500
+  #endif  //OLED_HISTBASE
+  #ifndef OLED_MIRROR                                 // 1 - frame mirroring stream (SetMirrorOLED); 0 - compiled out
+    #define OLED_MIRROR   1
+  #endif  //OLED_MIRROR
+  #if SCREEN_WIDTH<128                                // narrow panel: the column offset is set by the transport
+    #undef  OLED_PARTIALFLUSH
+    #define OLED_PARTIALFLUSH 1
+  #endif  //SCREEN_WIDTH
+  #if OLED_PARTIALFLUSH==0                            // the delta needs the shadow copy
+    #undef  OLED_MIRROR
+    #define OLED_MIRROR   0
+  #endif  //OLED_PARTIALFLUSH
+  #ifndef OLED_MIRRORCHUNK                            // mirror bytes handed to the sink at once
+    #define OLED_MIRRORCHUNK  32
+  #endif  //OLED_MIRRORCHUNK
+  #if _STATSOLED==1
+    #define OLED_STAT(x)  x
+  #else
+    #define OLED_STAT(x)
+  #endif  //_STATSOLED
 
   /****************************************************************************************/
   /*
   * common definitions
   */
+  // panel definitions
+  template<uint8_t W, uint8_t H> struct OledGeometry {    // panel geometry, all resolved at compile time
+    static constexpr uint8_t  width = W;
+    static constexpr uint8_t  height = H;
+    static constexpr uint8_t  pages = (H+7)/8;              // SSD1306 GDDRAM pages (8 pixel rows each)
+    static constexpr uint16_t bufSize = W*pages;            // frame buffer size in bytes
+    static constexpr uint8_t  colOffset = (128-W)/2;        // GDDRAM column of x=0 (narrow panels are centered)
+    static constexpr uint8_t  comPins = H==32 || H==16 ? 0x02 : 0x12;   // COM pins hardware configuration
+    static constexpr bool     adafruit = (W==128 && (H==32 || H==64)) || (W==96 && H==16);  // set up by Adafruit_SSD1306
+  } ; // end of OledGeometry
+  typedef   OledGeometry<SCREEN_WIDTH,SCREEN_HEIGHT> OledPanelGeometry;   // SCREEN_WIDTH x SCREEN_HEIGHT (OledConfig.h)
+  #define   SCREEN_PAGES    (OledPanelGeometry::pages)
+  #define   SCREEN_BUFSIZE  (OledPanelGeometry::bufSize)
+  #define   OLED_RESET      -1                        // Reset pin # (or -1 if sharing Arduino reset pin)
+  #define   SCREEN_ADDRESS  0x3C                      //< See datasheet for Address; 0x3D for 128x64, 0x3C for 128x32
+  #ifndef   OLED_PANELS
+    #define OLED_PANELS   3                 // max instances served by the bus arbiter (ServiceAllOLED)
+  #endif  //OLED_PANELS
+
   // stack definitions
-  #define   PAYLOADMAXLEN 20                // Max payload length for display
-  #define   OLEDQUEUELEN  8                 // Length of OLED display queue
-  #define  IMPLEMENTATION  FIFO
+  #ifndef   PAYLOADMAXLEN
+    #define PAYLOADMAXLEN 47                // Max payload length for display (a marquee strip)
+  #endif  //PAYLOADMAXLEN
+  #ifndef   OLEDQUEUELEN
+    #define OLEDQUEUELEN  8                 // Length of OLED display queue (FIFO of lane 0, max 254)
+  #endif  //OLEDQUEUELEN
+  #ifndef   OLED_ALERTQUEUELEN
+    #define OLED_ALERTQUEUELEN  2           // Length of the FIFO of each lane above 0 (max 254)
+  #endif  //OLED_ALERTQUEUELEN
+  #if OLEDQUEUELEN<2 || OLED_ALERTQUEUELEN<2
+    #error "OLEDQUEUELEN and OLED_ALERTQUEUELEN must be 2 at least (a flush on a full queue replaces the newest record)"
+  #endif
+  #ifndef   OLED_ARENALEN
+    #define OLED_ARENALEN 128               // bytes for payloads copied from regular memory, shared by the lanes
+  #endif  //OLED_ARENALEN
+  #define   OLED_SRC_NONE   0               // payload source: none (row left empty)
+  #define   OLED_SRC_PGM    1               // payload source: PROG MEM, referenced by <pgm>
+  #define   OLED_SRC_DYN    2               // payload source: regular memory, copied into <text>
+  #define   OLED_SRC_CLOCK  3               // payload source: time stamp at display time
+  #ifndef   OLED_LANES
+    #define OLED_LANES    2                 // priority lanes (max 8), lane 0 <OLEDQUEUELEN> long, the others <OLED_ALERTQUEUELEN>
+  #endif  //OLED_LANES
+  #define   OLED_RINGSLOTS  (OLEDQUEUELEN+1+(OLED_LANES-1)*(OLED_ALERTQUEUELEN+1))    // queue slots, all lanes
+  #define   OLED_LANE_NORMAL  0             // lane of status records
+  #define   OLED_LANE_ALERT   (OLED_LANES-1)  // highest lane
   struct OledStackDef {
-    char    payload0[PAYLOADMAXLEN];        // payload to line 0
-    char    payload1[PAYLOADMAXLEN];        // payload to line 1
-    char    payload2[PAYLOADMAXLEN];        // payload to line 2
-    uint8_t style;                          // display style {0,1,2,3,4,5,6,7}
+    const char* pgm[3];                     // PROG MEM payload per line (OLED_SRC_PGM)
+    uint16_t textAt;                        // arena offset of the regular memory payloads, back to back,
+                                            // each as length byte, chars, 0x00
+    uint8_t textLen;                        // arena bytes of the payloads
+    uint8_t len[3];                         // payload length per line, measured at push
+    uint8_t src[3];                         // payload source per line {OLED_SRC_*}
+    uint8_t key;                            // coalescing key, 0-none
+    uint8_t dwellMin;                       // min display time [100mS] (TickOLED)
+    uint8_t dwellMax;                       // max display time when nothing follows [100mS], 0-unlimited
+    uint8_t style;                          // display style {0,...,7}, custom styles from 8 (SetStyleOLED)
     uint8_t scroll;                         // status of scroll {4-no scroll;3-still;2-left;1-right;0-clear display}
     uint8_t RC;                             // 1-OK 0-Error
   } ; // end of OledStackDef
 
+  // text run: chars measured once, rendered in one call (width is <length>*6*text size)
+  struct OledTextRun {
+    const char* text;                       // chars, nullptr - empty
+    uint8_t length;                         // chars to render
+    bool    pgm;                            // <text> in PROG MEM
+  } ; // end of OledTextRun
+
+  // layouts: what a style draws, as constant tables (built in styles in Oled_1306.cpp, custom styles
+  // by the application with SetStyleOLED)
+  #ifndef   OLED_CUSTOMSTYLES
+    #define OLED_CUSTOMSTYLES 4             // custom styles {8,...,8+<OLED_CUSTOMSTYLES>-1}
+  #endif  //OLED_CUSTOMSTYLES
+  #define   OLED_LAYOUT_CLOCK   0x01        // layout flag: time on the bottom row, payload 2 not used
+  #define   OLED_LAYOUT_CLEAR   0x02        // layout flag: clear display, nothing drawn
+  struct OledRowDef {
+    uint8_t start;                          // row start line (page aligned for fast text)
+    uint8_t size;                           // text size {1,...,8}, 0 - row not used
+    bool    marquee;                        // single line: wider text runs as a marquee, else wraps
+  } ; // end of OledRowDef
+  #define   OLED_ROW_0    {OLED_Start_row_0,OLED_CharSize_row_0,true}   // geometry of rows {0,1,2,3}
+  #define   OLED_ROW_1    {OLED_Start_row_1,OLED_CharSize_row_1,true}   // from OledConfig.h
+  #define   OLED_ROW_2    {OLED_Start_row_2,OLED_CharSize_row_2,true}
+  #define   OLED_ROW_3    {OLED_Start_row_3,OLED_CharSize_row_3,false}
+  #define   OLED_ROW_NONE {0,0,false}
+  struct OledLayoutDef {
+    OledRowDef row[3];                      // geometry of payload 0..2, drawn in this order
+    const char* header;                     // PROG MEM text drawn instead of payload 0, nullptr - payload 0
+    uint8_t flags;                          // {OLED_LAYOUT_*}
+  } ; // end of OledLayoutDef
+
+  // retained screen (ScreenOLED): fields drawn in place, each redrawn only when its text changed
+  #ifndef   OLED_FIELDS
+    #define OLED_FIELDS   12                // max fields of a screen
+  #endif  //OLED_FIELDS
+  #ifndef   OLED_FIELDLEN
+    #define OLED_FIELDLEN 11                // max chars of a field
+  #endif  //OLED_FIELDLEN
+  struct OledFieldDef {
+    uint8_t x;                              // start column [pixels]
+    uint8_t start;                          // start line (page aligned for fast text)
+    uint8_t size;                           // text size {1,2,3}
+    uint8_t width;                          // chars of the field, cleared on a change {1,...,<OLED_FIELDLEN>}
+    const char* pgm;                        // PROG MEM fixed text (label), or
+    const char* bound;                      // regular memory text read on every refresh (bound variable);
+                                            // both nullptr - text set by SetFieldOLED
+  } ; // end of OledFieldDef
+
+  // marquee
+  #ifndef   OLED_MARQUEES
+    #define OLED_MARQUEES   2               // rows that can run a marquee at the same time
+  #endif  //OLED_MARQUEES
+  #ifndef   OLEDMARQUEELEN
+    #define OLEDMARQUEELEN  48              // max marquee text length (including 0x00)
+  #endif  //OLEDMARQUEELEN
+  struct OledMarqueeDef {
+    char    text[OLEDMARQUEELEN];           // text strip, repeated after <OLED_MarqueeGap> blanks
+    uint8_t length;                         // chars in <text>
+    uint8_t start;                          // row start line (page aligned)
+    uint8_t size;                           // text size {1,2,3}
+    bool    active;
+    uint16_t pos;                           // strip column at the left screen edge
+    uint32_t last;                          // millis() of the last step
+  } ; // end of OledMarqueeDef
+
+  // queue statistics
+  struct OledQueueStats {
+    uint32_t pushed;                        // records added to the queue
+    uint32_t coalesced;                     // pushes merged into a queued record (repeat or same key)
+    uint32_t dropped;                       // pushes lost on a full queue
+    uint32_t truncated;                     // payloads cut or left empty on a full arena
+  } ; // end of OledQueueStats
+
+  // flush statistics
+  struct OledFlushStats {
+    uint32_t flushes;                       // number of flush calls that reached the panel
+    uint32_t windows;                       // number of page windows transmitted
+    uint32_t transactions;                  // number of bus transactions (start..stop)
+    uint32_t bytesSent;                     // bytes written to the bus (address, control, command and data)
+    uint32_t dataBytes;                     // GDDRAM data bytes of <bytesSent>
+    uint32_t bytesSaved;                    // bytes not sent compared to a full frame display()
+    uint32_t mirrorFrames;                  // frames sent to the mirror sink
+    uint32_t mirrorBytes;                   // bytes sent to the mirror sink
+    uint32_t cacheHits;                     // records restored from the render cache
+    uint32_t flushSkips;                    // cached frames equal to the panel, not flushed
+    uint8_t  efficiency;                    // <dataBytes> of <bytesSent> [%]
+    bool     arbiter;                       // 1 - served by ServiceAllOLED; 0 - more instances than <OLED_PANELS>
+  } ; // end of OledFlushStats
+
+  // non blocking start up (StartOLED) states
+  #define   OLED_START_DONE     0           // display ready
+  #define   OLED_START_POWER    1           // power up delay
+  #define   OLED_START_SETTLE   2           // settle delay after the panel start
+  #define   OLED_START_PATTERN  3           // test pattern steps
+  #define   OLED_START_POST     4           // post test delay
+  #define   OLED_START_FAIL     5           // the panel failed to start
+
+  // render cache
+  #ifndef   OLED_RENDERCACHE
+    #define OLED_RENDERCACHE  4             // max frames in the render cache (SCREEN_BUFSIZE bytes each)
+  #endif  //OLED_RENDERCACHE
+
+  // mirror sink: receives the stream in parts of up to <OLED_MIRRORCHUNK> bytes
+  typedef void (*OledMirrorSink)(const uint8_t* data, uint16_t length, void* context);
+
+
+  // pipeline statistics
+  #define   OLED_STYLES   8                 // record styles {0,...,7}; slot 8 - direct draws, clock and marquee
+  struct OledPerfStats {
+    uint32_t renderTime[OLED_STYLES+1];     // uS spent drawing into the frame buffer, per style
+    uint32_t renders[OLED_STYLES+1];        // records drawn, per style
+    uint32_t flushTime[OLED_STYLES+1];      // uS spent on the bus, per style of the frame sent
+    uint32_t frames;                        // frames sent to the panel
+    uint32_t fps10;                         // frames per 10 seconds
+    uint32_t blockedTime;                   // uS waiting for a frame in transfer before drawing
+    uint32_t failedPushes;                  // pushes lost on a full queue
+    uint8_t  queueHigh;                     // queue depth high water mark
+    #if OLED_STATSHIST>0
+      uint16_t histogram[OLED_STATSHIST];   // frames by render+transfer time (see OLED_HISTBASE)
+    #endif  //OLED_STATSHIST
+  } ; // end of OledPerfStats
+
+  /****************************************************************************************/
+  class OledPanel : public Adafruit_SSD1306
+  {                                         // SSD1306 driver with a replaceable frame buffer
+    public:
+      OledPanel(uint8_t w, uint8_t h, TwoWire* twi, int8_t rst) : Adafruit_SSD1306(w,h,twi,rst) {}
+      OledPanel(uint8_t w, uint8_t h, SPIClass* spi, int8_t dc, int8_t rst, int8_t cs) :
+                    Adafruit_SSD1306(w,h,spi,dc,rst,cs) {}
+      uint8_t* SwapBuffer(uint8_t* other) {   // draw into <other> from now; returns the previous buffer
+        uint8_t* drawn = buffer;
+        buffer = other;
+        return  drawn;
+      }
+  };
   
   /****************************************************************************************/
   class Oled_1306
   {
     public:
-      Oled_1306(bool activate);		                    // constructor
+      Oled_1306(bool activate, uint8_t address=SCREEN_ADDRESS, TwoWire* wire=&Wire);  // constructor
+      Oled_1306(bool activate, SPIClass* spi, int8_t dc, int8_t rst, int8_t cs);      // constructor, SPI panel
+      ~Oled_1306();
+      Oled_1306(const Oled_1306&) = delete;             // owns buffers and is listed in the bus arbiter
+      Oled_1306& operator=(const Oled_1306&) = delete;
       bool begin(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDelay);
       uint8_t PopQueueDisplayOLED(TimePack _SysClock);
       bool PushQueueOLED(uint8_t style,  uint8_t scroll, bool flush,
                       const char* P0_pgm, char* P0_dyn, 
                       const char* P1_pgm, char* P1_dyn, 
-                      const char* P2_pgm=nullptr, char* P2_dyn=nullptr);      
+                      const char* P2_pgm=nullptr, char* P2_dyn=nullptr, uint8_t key=0, uint8_t lane=0);      
       void DisplayMemory(TimePack _SysClock, uint8_t type, char* row0_str=nullptr, 
                     char* row1_str=nullptr, char* row2_str=nullptr);
       void DisplayMix(TimePack _SysClock, uint8_t type, const char* row0_cst, 
@@ -80,9 +319,192 @@
       void DisplayProg(TimePack _SysClock, uint8_t type, const char* row0_const=nullptr, 
                     const char* row1_const=nullptr, const char* row2_const=nullptr);
       void SetCharsToRow(char* buffer, uint8_t row);
+      void FlushOLED();
+      OledFlushStats FlushStatsOLED();
+      bool ServiceOLED();
+      bool BusyOLED();
+      void SetFlushModeOLED(bool async, uint16_t budget=0);
+      void SetFastTextOLED(bool fast);
+      OledStackDef* ReserveQueueOLED(uint8_t lane=0);
+      bool CommitQueueOLED(bool flush=false, uint8_t lane=0);
+      bool PayloadQueueOLED(OledStackDef* slot, uint8_t row, const char* pgm, char* dyn=nullptr);
+      static OledTextRun TextRunOLED(const char* text, bool pgm=false);
+      void DrawRunOLED(const OledTextRun &run, uint8_t row);
+      uint8_t SetRenderCacheOLED(uint8_t frames);
+      bool StartOLED(TimePack _SysClock, uint8_t option, uint16_t PostDisplayDelay);
+      uint8_t StartStepOLED(TimePack _SysClock);
+      bool SetStyleOLED(uint8_t style, const OledLayoutDef* layout);
+      bool ScreenOLED(const OledFieldDef* fields, uint8_t count);
+      bool SetFieldOLED(uint8_t field, const char* text);
+      bool SetFieldOLED(uint8_t field, int32_t value);
+      uint8_t RefreshScreenOLED();
+      OledQueueStats QueueStatsOLED();
+      void SetLiveClockOLED(bool live);
+      uint8_t TickOLED(TimePack _SysClock, uint32_t now);
+      void SetDwellOLED(uint8_t dwellMin, uint8_t dwellMax);
+      void SetFrameRateOLED(uint8_t fps);
+      bool MarqueeOLED(uint8_t row, const char* pgm, char* dyn=nullptr);
+      void StopMarqueeOLED(uint8_t row);
+      void SetMarqueeOLED(bool autoLong, uint16_t stepTime=0);
+      static bool ServiceAllOLED(uint16_t budget=0);
+      OledPerfStats StatsOLED();
+      void ResetStatsOLED();
+      void SetMirrorOLED(Print* out);
+      void SetMirrorOLED(OledMirrorSink sink, void* context);
+      void MirrorKeyOLED();
+      bool SetDoubleBufferOLED(bool on);
+      void SetTransportOLED(OledTransport* bus);
+      uint32_t FrameCRCOLED();
+      const uint8_t* FrameOLED();
     private:
-      OledStackDef _Stack;
+      friend class OledTiles;               // tile text mode (OledTiles.h): font, time row, type layouts
+      void Init(bool activate, uint8_t address);
+      bool PanelBegin(TimePack _SysClock, uint8_t option);
+      void PanelReady();
+      uint16_t PatternStep(uint8_t option, uint16_t step);
+      void TickIdle();
+      void StartFlush();
+      void DrawReady();
+      void StatFrame(uint32_t frameTime);
+      void MirrorWindow(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data, const uint8_t* prev);
+      void MirrorLiteral(const uint8_t* data, const uint8_t* prev, uint8_t length);
+      void MirrorPut(uint8_t value);
+      void MirrorSend();
+      void SendWindow(uint8_t page, uint8_t col0, uint8_t col1, const uint8_t* data);
+      void FlushStep();
+      void FinishFlush();
+      void ScrollOLED(uint8_t mode);
+      const char* RowText(const OledStackDef* record, uint8_t row);
+      OledTextRun RowRun(const OledStackDef* record, uint8_t row);
+      const OledLayoutDef* Layout(uint8_t style);
+      void DisplayRows(TimePack _SysClock, const OledLayoutDef* layout, const OledTextRun* rows, uint32_t key=0);
+      uint32_t RenderKey(const OledStackDef* record);
+      bool CacheLoad(uint32_t key);
+      void CacheStore(uint32_t key);
+      void DisplayRow(uint8_t start, uint8_t size, const OledTextRun &run, bool marquee);
+      void DrawRun(uint8_t start, uint8_t size, const OledTextRun &run);
+      void PrintRecord(const OledStackDef* record);
+      bool SameRecord(const OledStackDef* a, const OledStackDef* b);
+      void CopyRecord(OledStackDef* to, const OledStackDef* from);
+      OledStackDef* ScratchSlot(uint8_t lane);
+      void FlushQueue(uint8_t lane);
+      void ApplyFlush(uint8_t lane);
+      bool PeekQueue(uint8_t lane, OledStackDef* record);
+      bool PopQueue(uint8_t lane, OledStackDef* record);
+      void ReleaseArena();
+      void ArenaOldest(const OledStackDef* record, uint16_t tail, uint16_t &oldest);
+      uint8_t TopLane();
+      uint8_t NextSource();
+      bool BlitText(uint8_t start, uint8_t size, const char* text, uint8_t length, int16_t x0=0);
+      static void FormatTime(char* buffer, uint8_t hour, uint8_t min, uint8_t sec);
+      bool TickClock();
+      static uint32_t ScaleColumn(uint8_t line, uint8_t size);
+      static uint32_t GlyphColumn(uint8_t c, uint8_t col, uint8_t size);
+      static const OledLayoutDef* TypeLayout(uint8_t type);
+      static bool RowGeometry(uint8_t row, uint8_t &start, uint8_t &size);
+      bool StartMarquee(uint8_t start, uint8_t size, const OledTextRun &run);
+      bool StepMarquee();
+      void MarqueeColumn(const OledMarqueeDef* marquee, uint8_t x, uint16_t column);
+      void ClearBuffer();
+      bool DrawField(uint8_t field, bool always);
+      OledPanel _display;                   // panel driver and frame buffer (back buffer when double buffered)
+      uint8_t* _spare;                      // double buffer: the buffer not drawn into (front), nullptr - single
+      uint8_t* _front;                      // frame in transfer
+      bool _presentPending;                 // double buffer: a drawn frame waits for the transfer
+      uint8_t _address;                     // panel I2C address
+      uint8_t _startState;                  // StartOLED state {OLED_START_*}
+      uint8_t _startOption;                 // test pattern of StartOLED
+      uint16_t _startStep;                  // next test pattern step
+      uint16_t _startWait;                  // mS from <_startAt> to the next step
+      uint16_t _startPost;                  // post test delay [mS]
+      uint32_t _startAt;
+      uint8_t* _cache;                      // render cache: frames without the time row, nullptr - off
+      uint32_t _cacheKey[OLED_RENDERCACHE]; // content hash per cached frame, 0 - empty
+      uint8_t _cacheFrames;                 // frames allocated
+      uint8_t _cacheNext;                   // frame replaced next (round robin)
+      const OledLayoutDef* _layout[OLED_STYLES+OLED_CUSTOMSTYLES];   // layout per style, nullptr - none
+      OledI2C _i2c;                         // I2C transport of the panel
+      OledSPI _spi;                         // SPI transport of the panel
+      OledTransport* _busOwn;               // transport of the constructor
+      OledTransport* _bus;                  // transport in use
+      #if OLED_PARTIALFLUSH==1
+        uint8_t _shadow[SCREEN_BUFSIZE];    // copy of the panel GDDRAM as last flushed
+      #endif  //OLED_PARTIALFLUSH
+      OledStackDef _Ring[OLED_RINGSLOTS];   // display queue, lane after lane; slot at <_head> of a lane is the producer scratch
+      volatile uint8_t _head[OLED_LANES];   // next slot to fill (written by producer only)
+      volatile uint8_t _tail[OLED_LANES];   // next slot to pop (written by consumer only)
+      volatile uint8_t _flushMark[OLED_LANES];  // first record kept by the last flush request
+      volatile uint8_t _flushSeq[OLED_LANES];   // flush requests (written by producer only)
+      volatile uint8_t _flushSeen[OLED_LANES];  // last queue flush request applied (written by consumer only)
+      OledStackDef _Resume[OLED_LANES>1 ? OLED_LANES-1 : 1];  // record interrupted by a higher lane, per lane (not the top one)
+      uint8_t _resume;                      // bit <lane> set: <_Resume[lane]> waits to resume
+      uint8_t _stackLane;                   // lane of the record on display
+      char _Arena[OLED_ARENALEN];           // payload ring of all lanes, in the order of the pushes
+      volatile uint16_t _arenaHead;         // next free byte (written by producer only)
+      volatile uint16_t _arenaTail;         // first byte in use (written by consumer only, ReleaseArena)
+      uint16_t _arenaRoom;                  // contiguous bytes for the slot being filled (producer)
+      static Oled_1306* _Panels[OLED_PANELS];   // instances served by ServiceAllOLED
+      static uint8_t _panelCount;
+      bool _arbiter;                        // listed in <_Panels>
+      static uint8_t _panelNext;            // next panel to get a page
+      OledStackDef _Stack;                  // record on display (consumer side)
+      OledFlushStats _Flush;
+      OledQueueStats _Queue;
       bool _activate;
+      bool _shadowValid;                    // shadow holds the panel GDDRAM content
+      bool _asyncFlush;                     // FlushOLED only starts the transfer
+      volatile bool _flushBusy;             // frame transfer in progress
+      bool _flushFull;                      // frame in progress is sent in full
+      bool _scrolling;                      // hardware scroll active
+      bool _fastText;                       // render text with BlitText
+      bool _scrollNext;                     // <_Stack> holds the next scroll step
+      bool _liveClock;                      // ServiceOLED advances the time row
+      bool _clockRow;                       // frame buffer holds a time row
+      char _clockShown[11];                 // time row as drawn
+      uint32_t _clockBase;                  // time row: seconds of day when drawn
+      uint32_t _clockMillis;                // time row: millis() when drawn
+      uint32_t _clockDue;                   // time row: millis() of the next second
+      uint8_t _dwellMin;                    // dwell for the next pushes [100mS]
+      uint8_t _dwellMax;
+      bool _shown;                          // scheduler: a record is on display
+      uint16_t _frameInterval;              // scheduler: min mS between frames
+      uint32_t _shownAt;                    // scheduler: when the record on display was shown
+      uint32_t _lastFrame;                  // scheduler: when the last frame was rendered
+      const OledFieldDef* _screen;          // retained screen, nullptr - none
+      uint8_t _screenFields;                // fields of <_screen>
+      bool _screenDrawn;                    // frame buffer holds the screen (cleared by a record)
+      char _fieldText[OLED_FIELDS][OLED_FIELDLEN+1];    // field text set by SetFieldOLED
+      char _fieldShown[OLED_FIELDS][OLED_FIELDLEN+1];   // field text as drawn on the panel
+      OledMarqueeDef _Marquee[OLED_MARQUEES];
+      uint8_t _marqueeCount;                // active marquees
+      bool _marqueeAuto;                    // long queued rows run as marquee
+      uint16_t _marqueeStep;                // mS per column shift
+      uint8_t _flushPage;                   // next page to send
+      uint8_t _pendingScroll;               // scroll mode+1 to start after the transfer, 0-none
+      uint16_t _flushBudget;                // max uS per ServiceOLED call
+      uint32_t _flushStart;                 // bytes sent count at frame start
+      #if OLED_MIRROR==1
+        Print* _mirrorOut;                  // mirror sink: stream (Serial, WiFiClient)
+        OledMirrorSink _mirrorSink;         // mirror sink: callback
+        void* _mirrorContext;
+        bool _mirrorKey;                    // next frame is a key frame
+        bool _mirrorFrameKey;               // frame in transfer is a key frame
+        bool _mirrorOpen;                   // frame header sent
+        uint8_t _mirrorSeq;                 // frame sequence
+        uint8_t _mirrorLen;                 // bytes in <_mirrorBuf>
+        uint8_t _mirrorBuf[OLED_MIRRORCHUNK];
+      #endif  //OLED_MIRROR
+      #if _STATSOLED==1
+        OledPerfStats _Stats;
+        uint32_t _statsSince;               // millis() of the last reset
+        uint32_t _statsDropped;             // dropped pushes at the last reset
+        uint32_t _statFlushTime;            // uS on the bus, running
+        uint32_t _frameRender;              // uS drawing the frame in transfer
+        uint32_t _frameFlush;               // uS on the bus for the frame in transfer
+        uint8_t _drawStyle;                 // style being drawn, <OLED_STYLES> - direct draw
+        uint8_t _frameStyle;                // style of the frame in transfer
+        uint8_t _pendingStyle;              // style of the frame waiting (double buffer)
+      #endif  //_STATSOLED
   };
 
 #endif   //Oled1306_h